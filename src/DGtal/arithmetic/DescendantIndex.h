@@ -0,0 +1,182 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DescendantIndex.h
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module DescendantIndex.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DescendantIndex_RECURSES)
+#error Recursive header files inclusion detected in DescendantIndex.h
+#else // defined(DescendantIndex_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DescendantIndex_RECURSES
+
+#if !defined DescendantIndex_h
+/** Prevents repeated inclusion of headers. */
+#define DescendantIndex_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <atomic>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/NumberTraits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DescendantIndex
+  /**
+     Description of template class 'DescendantIndex' <p>
+     \brief Aim: An index quotient -> node of the descendants of a
+     node of a Stern-Brocot tree, which may be looked up without
+     lock while other threads add descendants.
+
+     LightSternBrocot and LighterSternBrocot keep the descendants of
+     a node in maps, which cannot be read while another thread
+     inserts in them. Each node thus also publishes its descendants
+     in this index: an open-addressing hash table whose slots are
+     atomic pointers. A lookup is a few acquire loads and never
+     blocks. Descendants are only added under the tree mutex, which
+     serializes the writers.
+
+     When the table is half full, a table twice as large is filled
+     and then published. The previous tables are kept until the
+     index is destroyed, since a reader may still probe them. They
+     take at most as much memory as the current table.
+
+     @tparam TKey the type of the keys, a model of CInteger (the
+     quotients of the tree).
+
+     @tparam TNode the type of the nodes of the tree.
+
+     @see LightSternBrocot, LighterSternBrocot
+  */
+  template <typename TKey, typename TNode>
+  class DescendantIndex
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef TKey Key;
+    typedef TNode Node;
+
+    /**
+     * Destructor.
+     */
+    ~DescendantIndex();
+
+    /**
+     * Constructor. The index is empty and allocates nothing.
+     */
+    DescendantIndex();
+
+    /**
+       Lock-free lookup.
+
+       @param key any key.
+       @return the node published with this key, or 0 if there is
+       none (yet).
+    */
+    Node* find( const Key & key ) const;
+
+    /**
+       Publishes a node with the given key, which must not be already
+       in the index. Writers must be serialized (by the tree mutex),
+       readers may call find meanwhile.
+
+       @param key any key.
+       @param node the node associated to this key (not 0).
+    */
+    void publish( const Key & key, Node* node );
+
+    /// @return the number of published nodes (writers only).
+    std::size_t size() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// A table of 2^n slots. The key of a slot is written before its
+    /// node pointer is published, and never changes afterwards.
+    struct Table
+    {
+      Table( std::size_t capacity, Table* previousTable );
+      std::size_t mask;
+      std::vector<Key> keys;
+      std::vector< std::atomic<Node*> > nodes;
+      /// The table that was replaced by this one.
+      Table* previous;
+    };
+
+    /// The current table (0 while the index is empty).
+    std::atomic<Table*> myTable;
+    /// The number of published nodes.
+    std::size_t mySize;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    DescendantIndex ( const DescendantIndex & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    DescendantIndex & operator= ( const DescendantIndex & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @return the hash value of the given key.
+    static std::size_t hash( const Key & key );
+
+    /// Inserts a key in a table that has a free slot.
+    static void insert( Table & table, const Key & key, Node* node );
+
+  }; // end of class DescendantIndex
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/arithmetic/DescendantIndex.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DescendantIndex_h
+
+#undef DescendantIndex_RECURSES
+#endif // else defined(DescendantIndex_RECURSES)
@@ -44,11 +44,14 @@
 // Inclusions
 #include <iostream>
 #include <vector>
+#include <deque>
+#include <mutex>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/StdRebinders.h"
 #include "DGtal/base/InputIteratorWithRankOnSequence.h"
 #include "DGtal/kernel/CInteger.h"
 #include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/arithmetic/DescendantIndex.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -94,6 +97,13 @@ namespace DGtal
    duplicate it. Use static method LighterSternBrocot::fraction to obtain
    your fractions.
 
+   The tree is thread-safe: fractions may be created and navigated
+   from several threads at once. The descendants of a node are
+   stored in maps, whose insertions are protected by a mutex, and
+   are also published in a DescendantIndex, so that following an
+   existing descendant is lock-free. Nodes are allocated in blocks
+   and released together with the tree.
+
    @tparam TInteger the integral type chosen for the fractions.
 
    @tparam TQuotient the integral type chosen for the
@@ -117,6 +127,7 @@ namespace DGtal
 
     struct Node;
     typedef typename TMap:: template Rebinder<Quotient, Node*>::Type MapQuotientToNode;
+    typedef DescendantIndex<Quotient, Node> IndexQuotientToNode;
 
   public:
 
@@ -187,6 +198,8 @@ namespace DGtal
       /// key. Note that they are left or right descendant according
       /// to the parity of the depth.  (odd=left, even=right).
       MapQuotientToNode myChildren;
+      /// the nodes of myChildren, published for lock-free lookups.
+      IndexQuotientToNode myPublishedChildren;
 
 
       /// @return 'true' iff this node has an even depth.
@@ -550,6 +563,11 @@ namespace DGtal
     Node* myOneOverZero;
     Node* myOneOverOne;
 
+    /// Storage of all the nodes of the tree (stable addresses).
+    std::deque<Node> myNodes;
+    /// Serializes the insertions of descendants (maps and indices).
+    std::mutex myMutex;
+
     // ------------------------- Hidden services ------------------------------
   protected:
 
@@ -578,6 +596,16 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+       Allocates a new node in the tree storage. The tree mutex
+       should be locked.
+
+       @see Node::Node
+       @return a pointer to the new node.
+    */
+    Node* newNode( Integer p1, Integer q1, Quotient u1, Quotient k1,
+                   Node* anOrigin );
+
   }; // end of class LighterSternBrocot
 
 
@@ -44,6 +44,9 @@
 // Inclusions
 #include <iostream>
 #include <vector>
+#include <deque>
+#include <atomic>
+#include <mutex>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/InputIteratorWithRankOnSequence.h"
 #include "DGtal/kernel/CInteger.h"
@@ -67,6 +70,13 @@ namespace DGtal
    duplicate it. Use static method SternBrocot::fraction to obtain
    your fractions.
 
+   The tree is thread-safe: fractions may be created and navigated
+   from several threads at once (e.g. in OpenMP loops over
+   StandardDSLQ0 objects). Following an existing descendant is
+   lock-free (one atomic load), while the creation of new nodes is
+   serialized by a mutex. Nodes are allocated in blocks and released
+   together with the tree.
+
    @tparam TInteger the integral type chosen for the fractions.
 
    @tparam TQuotient the integral type chosen for the
@@ -131,9 +141,9 @@ namespace DGtal
       /// the node that is the right ascendant.
       Node* ascendantRight;
       /// the node that is the left descendant or 0 (if none exist).
-      Node* descendantLeft;
+      std::atomic<Node*> descendantLeft;
       /// the node that is the right descendant or 0 (if none exist).
-      Node* descendantRight;
+      std::atomic<Node*> descendantRight;
       /// the node that is its inverse.
       Node* inverse;
     };
@@ -471,6 +481,11 @@ namespace DGtal
     Node* myOneOverZero;
     Node* myOneOverOne;
 
+    /// Storage of all the nodes of the tree (stable addresses).
+    std::deque<Node> myNodes;
+    /// Serializes the creation of nodes.
+    std::mutex myMutex;
+
     // ------------------------- Hidden services ------------------------------
   private:
 
@@ -497,6 +512,18 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+       Allocates a new node in the tree storage. The tree mutex
+       should be locked.
+
+       @see Node::Node
+       @return a pointer to the new node.
+    */
+    Node* newNode( Integer p1, Integer q1, Quotient u1, Quotient k1,
+                   Node* ascendant_left1, Node* ascendant_right1,
+                   Node* descendant_left1, Node* descendant_right1,
+                   Node* inverse1 );
+
   }; // end of class SternBrocot
 
 
@@ -44,6 +44,7 @@
 #include <vector>
 #include <map>
 #include <list>
+#include <type_traits>
 #include <boost/array.hpp>
 #include <boost/unordered_map.hpp>
 #include "DGtal/kernel/SpaceND.h"
@@ -87,6 +88,13 @@ namespace DGtal
    * This is used to describe the space on which the dec is build and to compute various operators.
    * Once operators or kforms are created, this structure should not be modified.
    *
+   * Operators are assembled from the cells in index order (see
+   * updateIndexes()), in parallel if DGtal has been built with OpenMP
+   * support (WITH_OPENMP flag set to "true"), by filling the compressed
+   * storage of sparse matrices directly. Derivative, antiderivative,
+   * hodge and laplace matrices are cached by order and duality until
+   * cells are inserted or erased, or sizes are reset.
+   *
    * @tparam dimEmbedded dimension of emmbedded manifold.
    * @tparam dimAmbient dimension of ambient manifold.
    * @tparam TLinearAlgebraBackend linear algebra backend used (i.e. EigenSparseLinearAlgebraBackend).
@@ -566,6 +574,39 @@ namespace DGtal
      */
     bool myIndexesNeedUpdate;
 
+    /**
+     * Key of cached operator matrices: order and duality of the input k-form.
+     */
+    typedef std::pair<Order, Duality> OperatorKey;
+
+    /**
+     * Cached operator matrices.
+     */
+    typedef std::map<OperatorKey, SparseMatrix> OperatorMatrixes;
+
+    /**
+     * Cached derivative operator matrices.
+     * Cached operator matrices are filled by const methods: they are
+     * only read or written through findCachedOperator and
+     * cacheOperator, in a critical section.
+     */
+    mutable OperatorMatrixes myDerivativeMatrixes;
+
+    /**
+     * Cached antiderivative operator matrices.
+     */
+    mutable OperatorMatrixes myAntiderivativeMatrixes;
+
+    /**
+     * Cached hodge operator matrices.
+     */
+    mutable OperatorMatrixes myHodgeMatrixes;
+
+    /**
+     * Cached laplace operator matrices.
+     */
+    mutable OperatorMatrixes myLaplaceMatrixes;
+
 
     // ------------------------- Hidden services ------------------------------
   protected:
@@ -573,6 +614,70 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+     * Entries of a sparse matrix stored row by row, with room for at
+     * most 'stride' entries in each row, so that different rows can
+     * be filled in parallel.
+     */
+    struct RowEntries
+    {
+        RowEntries(const Index& rows, const Index& _stride)
+            : stride(_stride), sizes(rows, 0), cols(rows*_stride), values(rows*_stride)
+        {}
+
+        void
+        push(const Index& row, const Index& col, const Scalar& value)
+        {
+            FATAL_ERROR_MSG( sizes[row] < stride, "too many entries in a sparse matrix row" );
+            const Index entry = row*stride + sizes[row]++;
+            cols[entry] = col;
+            values[entry] = value;
+        }
+
+        Index stride;
+        std::vector<Index> sizes;
+        std::vector<Index> cols;
+        std::vector<Scalar> values;
+    };
+
+    /**
+     * Fill the compressed storage of a sparse matrix directly from
+     * its entries, without sorting triplets. As with setFromTriplets,
+     * duplicated entries are summed.
+     * @param matrix output sparse matrix.
+     * @param rows number of rows of the matrix.
+     * @param cols number of columns of the matrix.
+     * @param entries entries of the matrix.
+     */
+    static void
+    setFromRowEntries(SparseMatrix& matrix, const Index& rows, const Index& cols, const RowEntries& entries);
+
+    /**
+     * Look up a cached operator matrix.
+     * @param cache operator matrices cache.
+     * @param key order and duality of the operator input.
+     * @param matrix output copy of the cached matrix, if any.
+     * @return true if the operator was cached.
+     */
+    static bool
+    findCachedOperator(const OperatorMatrixes& cache, const OperatorKey& key, SparseMatrix& matrix);
+
+    /**
+     * Cache an operator matrix. If another thread cached it meanwhile,
+     * the cached matrix is kept.
+     * @param cache operator matrices cache.
+     * @param key order and duality of the operator input.
+     * @param matrix operator matrix.
+     */
+    static void
+    cacheOperator(OperatorMatrixes& cache, const OperatorKey& key, const SparseMatrix& matrix);
+
+    /**
+     * Invalidate all cached operators after a structure or size modification.
+     */
+    void
+    invalidateCachedOperators();
+
     /**
      * Update sharp and flat operators cache.
      */
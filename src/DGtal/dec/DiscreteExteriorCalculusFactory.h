@@ -39,8 +39,12 @@
 #define DiscreteExteriorCalculusFactory_h
 
 //////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include <set>
+#include <algorithm>
 #include "DGtal/dec/DiscreteExteriorCalculus.h"
 #include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/CubicalComplex.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -53,6 +57,15 @@ namespace DGtal
  * \brief Aim:
  * This class provides static members to create DEC structures from various other DGtal structures.
  *
+ * Structures are built in a few passes over the input, without
+ * inserting cells one by one: the faces of the input n-cells (or
+ * spels) are enumerated in parallel if DGtal has been built with
+ * OpenMP support (WITH_OPENMP flag set to "true"), each face being
+ * generated once by the lowest n-cell it is incident to. The cell
+ * index tables are then filled directly, cells being indexed in
+ * lexicographic order. Time and memory only depend on the number of
+ * input cells, not on the size of their domain.
+ *
  * @tparam TLinearAlgebraBackend linear algebra backend used (i.e. EigenLinearAlgebraBackend).
  * @tparam TInteger integer type forwarded to khalimsky space.
  */
@@ -103,6 +116,33 @@ public:
     DiscreteExteriorCalculus<dimEmbedded, TNSCellConstIterator::value_type::Point::dimension, TLinearAlgebraBackend, TInteger>
     createFromNSCells(const TNSCellConstIterator& begin, const TNSCellConstIterator& end, const bool add_border = true);
 
+    /**
+     * Create a DEC structure from a digital surface, whose surfels are the n-cells of the structure.
+     * Same as createFromNSCells<KSpace::dimension-1>(surface.begin(), surface.end(), add_border).
+     * @tparam TDigitalSurfaceContainer digital surface container type.
+     * @param surface the digital surface from which to build the DEC structure.
+     * @param add_border add border to the computed structure. For a precise definition see section \ref sectDECBorderDefinition.
+     */
+    template <typename TDigitalSurfaceContainer>
+    static
+    DiscreteExteriorCalculus<TDigitalSurfaceContainer::KSpace::dimension-1, TDigitalSurfaceContainer::KSpace::dimension, TLinearAlgebraBackend, TInteger>
+    createFromDigitalSurface(const DigitalSurface<TDigitalSurfaceContainer>& surface, const bool add_border = true);
+
+    /**
+     * Create a DEC structure from the n-cells of a cubical complex, where n is the embedded dimension.
+     * N-cells get positive orientation. Lower dimensional cells of the complex are not used,
+     * the structure holding all the lower incident cells of its n-cells.
+     * @tparam dimEmbedded dimension of emmbedded manifold.
+     * @tparam TKSpace Khalimsky space type of the complex, which should be the Khalimsky space of the DEC structure.
+     * @tparam TCellContainer cell container type of the complex.
+     * @param complex the cubical complex from which to build the DEC structure.
+     * @param add_border add border to the computed structure. For a precise definition see section \ref sectDECBorderDefinition.
+     */
+    template <Dimension dimEmbedded, typename TKSpace, typename TCellContainer>
+    static
+    DiscreteExteriorCalculus<dimEmbedded, TKSpace::dimension, TLinearAlgebraBackend, TInteger>
+    createFromCubicalComplex(const CubicalComplex<TKSpace, TCellContainer>& complex, const bool add_border = true);
+
     // ----------------------- Interface --------------------------------------
 public:
 
@@ -129,19 +169,75 @@ protected:
     insertAllLowerIncidentCells(const KSpace& kspace, const typename CellsSet::value_type& cell, CellsSet& cells_set);
 
     /**
-     * Insert and count recursively all lower incident cells into cells accumulator, starting from cell.
+     * Fill a DEC structure from signed n-cells, which get attached to primal n-cell <-> dual 0-cell.
+     * Faces of n-cells are generated in parallel by computeFaces.
      * Internal use only.
+     * @tparam Calculus DEC structure type.
+     * @param calculus the empty DEC structure to fill.
+     * @param ncells signed n-cells.
+     * @param add_border add border to the computed structure.
+     */
+    template <typename Calculus>
+    static
+    void
+    fillFromNSCells(Calculus& calculus, const std::vector<typename Calculus::SCell>& ncells, const bool add_border);
+
+    /**
+     * Compute the faces of n-cells, with the number of n-cells each face is incident to.
+     * Each face is generated once, by the lowest n-cell it is incident to, so that
+     * no buffer larger than the output is needed. N-cells are processed in parallel.
+     * Internal use only.
+     * @tparam dimEmbedded dimension n of the n-cells.
      * @tparam KSpace Khalimsky space type.
-     * @tparam CellsAccum cells accumulator type, should be similar to std::map<KSpace::Cell, int> or std::map<KSpace::SCell, int>.
-     * Counts are stored as values, cells are stored as keys.
-     * @param kspace Khalimsky space instance.
-     * @param cell starting cell.
-     * @param cells_accum cells accumulator in which lower incident cells get inserted and counted.
+     * @tparam Index index type.
+     * @param kspace Khalimsky space of the cells.
+     * @param ncells n-cells, sorted and without duplicates.
+     * @param faces output faces of the n-cells (of dimension lower than n), sorted, with their number of incident n-cells.
+     */
+    template <DGtal::Dimension dimEmbedded, typename KSpace, typename Index>
+    static
+    void
+    computeFaces(const KSpace& kspace, const std::vector<typename KSpace::Cell>& ncells, std::vector< std::pair<typename KSpace::Cell, Index> >& faces);
+
+    /**
+     * Faces of a n-cell that are generated by this n-cell, i.e. that are not incident to a lower n-cell.
+     * Internal use only.
+     * @tparam dimEmbedded dimension n of the n-cells.
+     * @tparam KSpace Khalimsky space type.
+     * @tparam Index index type.
+     * @param kspace Khalimsky space of the cells.
+     * @param ncells n-cells, sorted and without duplicates.
+     * @param ncell_index index of the n-cell in ncells.
+     * @param faces if not null, output faces with their number of incident n-cells.
+     * @return the number of faces generated by the n-cell.
+     */
+    template <DGtal::Dimension dimEmbedded, typename KSpace, typename Index>
+    static
+    Index
+    ownedFaces(const KSpace& kspace, const std::vector<typename KSpace::Cell>& ncells, const Index& ncell_index, std::pair<typename KSpace::Cell, Index>* faces);
+
+    /**
+     * Sort a vector of (cell, value) pairs, chunks being sorted in parallel then merged.
+     * Internal use only.
+     * @tparam CellWeights vector of pairs type.
+     * @param cell_weights the pairs to sort.
+     */
+    template <typename CellWeights>
+    static
+    void
+    sortCellWeights(CellWeights& cell_weights);
+
+    /**
+     * Set the cells of a DEC structure and fill its index tables, cells being indexed in the given order.
+     * Internal use only.
+     * @tparam Calculus DEC structure type.
+     * @param calculus the DEC structure.
+     * @param cells cells with their properties.
      */
-    template <typename KSpace, typename CellsAccum>
+    template <typename Calculus>
     static
     void
-    accumulateAllLowerIncidentCells(const KSpace& kspace, const typename CellsAccum::key_type& cell, CellsAccum& cells_accum);
+    setIndexedCells(Calculus& calculus, const std::vector< std::pair<typename Calculus::Cell, typename Calculus::Property> >& cells);
 
 private:
 
@@ -0,0 +1,391 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DiscreteExteriorCalculusMultigrid.h
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module DiscreteExteriorCalculusMultigrid.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DiscreteExteriorCalculusMultigrid_RECURSES)
+#error Recursive header files inclusion detected in DiscreteExteriorCalculusMultigrid.h
+#else // defined(DiscreteExteriorCalculusMultigrid_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DiscreteExteriorCalculusMultigrid_RECURSES
+
+#if !defined DiscreteExteriorCalculusMultigrid_h
+/** Prevents repeated inclusion of headers. */
+#define DiscreteExteriorCalculusMultigrid_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/Duality.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  template <typename TCalculus>
+  class DiscreteExteriorCalculusMultigridPreconditioner;
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DiscreteExteriorCalculusMultigrid
+  /**
+   * Description of template class 'DiscreteExteriorCalculusMultigrid' <p>
+   * \brief Aim:
+   * Geometric multigrid solver for linear problems on 0-forms of a
+   * discrete exterior calculus built from a digital set, such as
+   * Poisson or heat problems. It is a model of
+   * concepts::CLinearAlgebraSolver and can be used with
+   * DiscreteExteriorCalculusSolver.
+   *
+   * The hierarchy is given by the natural coarsening of the
+   * Khalimsky grid: each coarse level is the calculus of the digital
+   * set downsampled by 2 along every axis. Dual 0-forms (spels) are
+   * prolongated by multilinear interpolation of the coarse spel
+   * centers, primal 0-forms (pointels) by multilinear interpolation of
+   * the coarse pointels. Weights of missing coarse cells are
+   * redistributed over the present ones. Restriction is the transposed prolongation and
+   * coarse operators are Galerkin products, so that symmetric
+   * problems stay symmetric on every level.
+   *
+   * Each cycle is a V-cycle with damped Jacobi smoothing. The coarsest
+   * level is solved with a sparse Cholesky factorization. Without a
+   * hierarchy (see setHierarchy), the solver reduces to that
+   * factorization.
+   *
+   * @code
+   * typedef DiscreteExteriorCalculusMultigrid<Calculus> Multigrid;
+   * typedef DiscreteExteriorCalculusSolver<Calculus, Multigrid, 0, DUAL, 0, DUAL> Solver;
+   * Solver solver;
+   * solver.myLinearAlgebraSolver.setHierarchy(calculus, set, DUAL, add_border);
+   * solver.compute(laplace);
+   * const Calculus::DualForm0 solution = solver.solve(input);
+   * @endcode
+   *
+   * DiscreteExteriorCalculusMultigridPreconditioner applies a single
+   * V-cycle and is meant to precondition conjugate gradient
+   * (see SolverConjugateGradient).
+   *
+   * @tparam TCalculus should be DiscreteExteriorCalculus with
+   * EigenLinearAlgebraBackend, with equal embedded and ambient dimensions.
+   */
+  template <typename TCalculus>
+  class DiscreteExteriorCalculusMultigrid
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef TCalculus Calculus;
+    typedef DiscreteExteriorCalculusMultigrid<TCalculus> Self;
+
+    BOOST_STATIC_ASSERT(( Calculus::dimensionEmbedded == Calculus::dimensionAmbient ));
+
+    typedef typename Calculus::LinearAlgebraBackend LinearAlgebraBackend;
+    typedef typename Calculus::Scalar Scalar;
+    typedef typename Calculus::Index Index;
+    typedef typename Calculus::DenseVector DenseVector;
+    typedef typename Calculus::SparseMatrix SparseMatrix;
+    typedef typename Calculus::KSpace KSpace;
+    typedef typename Calculus::Cell Cell;
+    typedef typename Calculus::SCell SCell;
+    typedef typename Calculus::Point Point;
+    typedef typename KSpace::Integer Integer;
+    ///Type of the compressed storage indexes (SparseMatrix::StorageIndex since Eigen 3.3).
+    typedef typename std::remove_reference<decltype(*std::declval<SparseMatrix&>().outerIndexPtr())>::type StorageIndex;
+    typedef DiscreteExteriorCalculusFactory<LinearAlgebraBackend, Integer> CalculusFactory;
+
+    ///Row major storage of level operators, applied row by row in parallel.
+    typedef Eigen::SparseMatrix<Scalar, Eigen::RowMajor, StorageIndex> LevelMatrix;
+
+    ///Solver of the coarsest level.
+    typedef Eigen::SimplicialLDLT<SparseMatrix> CoarseSolver;
+
+    ///Single V-cycle preconditioner.
+    typedef DiscreteExteriorCalculusMultigridPreconditioner<TCalculus> Preconditioner;
+
+    ///Conjugate gradient solver preconditioned by a multigrid V-cycle, for symmetric definite problems.
+    typedef Eigen::ConjugateGradient<SparseMatrix, Eigen::Lower|Eigen::Upper, Preconditioner> SolverConjugateGradient;
+
+    /**
+     * Constructor.
+     * Default tolerance is 1e-8, on the relative residual, with at most
+     * 100 cycles and 2 damped Jacobi sweeps (relaxation 2/3) before and
+     * after each coarse correction.
+     */
+    DiscreteExteriorCalculusMultigrid();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Builds the level hierarchy for 0-forms of the given duality.
+     * The fine calculus should be created from set with
+     * DiscreteExteriorCalculusFactory::createFromDigitalSet and the
+     * same add_border value. Coarsening stops when the number of
+     * 0-forms falls below coarsest_size or when max_levels is reached.
+     * Must be called before compute.
+     * @tparam TDigitalSet type of digital set, model of concepts::CDigitalSet.
+     * @param calculus the fine discrete exterior calculus.
+     * @param set the digital set of the fine calculus.
+     * @param duality duality of the 0-forms.
+     * @param add_border add border to the coarse calculi.
+     * @param max_levels maximal number of levels, including the fine one.
+     * @param coarsest_size 0-forms count below which coarsening stops.
+     */
+    template <typename TDigitalSet>
+    void setHierarchy(const Calculus& calculus, const TDigitalSet& set, const Duality duality,
+                      const bool add_border = true, const std::size_t max_levels = 16, const Index coarsest_size = 1000);
+
+    /**
+     * Computes the coarse operators of the hierarchy and factorizes
+     * the coarsest one.
+     * @param matrix the fine operator.
+     * @return *this.
+     */
+    template <typename TMatrix>
+    Self& compute(const TMatrix& matrix);
+
+    /**
+     * Solves the problem with V-cycles, starting from zero.
+     * @param input right hand side.
+     * @return problem solution.
+     */
+    DenseVector solve(const DenseVector& input) const;
+
+    /**
+     * @return Eigen::Success if the last compute or solve succeeded.
+     */
+    Eigen::ComputationInfo info() const;
+
+    /// Sets the tolerance on the relative residual.
+    Self& setTolerance(const Scalar tolerance);
+
+    /// @return the tolerance on the relative residual.
+    Scalar tolerance() const;
+
+    /// Sets the maximal number of cycles.
+    Self& setMaxIterations(const Index max_iterations);
+
+    /// @return the maximal number of cycles.
+    Index maxIterations() const;
+
+    /**
+     * Sets the damped Jacobi smoother parameters.
+     * @param steps number of sweeps before and after each coarse correction.
+     * @param relaxation damping factor.
+     * @return *this.
+     */
+    Self& setSmoother(const int steps, const Scalar relaxation);
+
+    /// @return the number of cycles of the last solve.
+    Index iterations() const;
+
+    /// @return the relative residual of the last solve.
+    Scalar error() const;
+
+    /// @return the number of levels, including the fine one.
+    std::size_t nbLevels() const;
+
+    /// @return the number of 0-forms of a level.
+    Index levelSize(const std::size_t level) const;
+
+    /**
+     * Prolongation of coarse values.
+     * @param level fine level, smaller than nbLevels()-1.
+     * @param coarse_values values on level+1.
+     * @return values on level.
+     */
+    DenseVector prolongation(const std::size_t level, const DenseVector& coarse_values) const;
+
+    /**
+     * Restriction of fine values.
+     * @param level fine level, smaller than nbLevels()-1.
+     * @param fine_values values on level.
+     * @return values on level+1.
+     */
+    DenseVector restriction(const std::size_t level, const DenseVector& fine_values) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay(std::ostream& out) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * Level of the hierarchy. Prolongation and restriction link the
+     * level to the next coarser one and are empty on the coarsest level.
+     */
+    struct Level
+    {
+      Index size;
+      LevelMatrix matrix;
+      DenseVector inverse_diagonal;
+      LevelMatrix prolongation;
+      LevelMatrix restriction;
+    };
+
+    std::vector<Level> myLevels;
+    CoarseSolver myCoarseSolver;
+    Scalar myTolerance;
+    Index myMaxIterations;
+    int mySmoothingSteps;
+    Scalar myRelaxation;
+    bool myIsComputed;
+    Eigen::ComputationInfo myComputeInfo;
+    mutable Eigen::ComputationInfo myInfo;
+    mutable Index myIterations;
+    mutable Scalar myError;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Applies one V-cycle from level down to the coarsest level.
+     * @param level current level.
+     * @param input right hand side.
+     * @param[in,out] solution current solution.
+     * @param zero_guess true when solution is zero on input.
+     */
+    void cycle(const std::size_t level, const DenseVector& input, DenseVector& solution, const bool zero_guess) const;
+
+    /**
+     * Damped Jacobi sweeps.
+     * @param level current level.
+     * @param input right hand side.
+     * @param[in,out] solution current solution.
+     * @param steps number of sweeps.
+     * @param zero_guess true when solution is zero on input.
+     */
+    void smooth(const std::size_t level, const DenseVector& input, DenseVector& solution, const int steps, bool zero_guess) const;
+
+    /**
+     * Computes input - matrix * solution.
+     * @param matrix level operator.
+     * @param input right hand side.
+     * @param solution current solution.
+     * @param[out] residual residual.
+     */
+    static void residual(const LevelMatrix& matrix, const DenseVector& input, const DenseVector& solution, DenseVector& residual);
+
+    /**
+     * Computes matrix * input, row by row in parallel.
+     * @param matrix row major matrix.
+     * @param input input values.
+     * @param[out] output output values.
+     */
+    static void multiply(const LevelMatrix& matrix, const DenseVector& input, DenseVector& output);
+
+    /**
+     * Builds the prolongation from coarse 0-forms to fine 0-forms.
+     * @param fine fine calculus.
+     * @param coarse coarse calculus.
+     * @param duality duality of the 0-forms.
+     * @return the prolongation matrix.
+     */
+    static LevelMatrix buildProlongation(const Calculus& fine, const Calculus& coarse, const Duality duality);
+
+    /**
+     * @return the halved value, rounded towards minus infinity.
+     */
+    static Integer halve(const Integer value);
+
+    /**
+     * @return the point with halved coordinates, rounded towards minus infinity.
+     */
+    template <typename TPoint>
+    static TPoint halve(const TPoint& point);
+
+  }; // end of class DiscreteExteriorCalculusMultigrid
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DiscreteExteriorCalculusMultigridPreconditioner
+  /**
+   * Description of template class 'DiscreteExteriorCalculusMultigridPreconditioner' <p>
+   * \brief Aim:
+   * Eigen preconditioner applying a single multigrid V-cycle, see
+   * DiscreteExteriorCalculusMultigrid::SolverConjugateGradient. The
+   * hierarchy is set through the preconditioner() accessor of the
+   * Eigen solver before calling compute.
+   *
+   * @tparam TCalculus should be DiscreteExteriorCalculus with
+   * EigenLinearAlgebraBackend, with equal embedded and ambient dimensions.
+   */
+  template <typename TCalculus>
+  class DiscreteExteriorCalculusMultigridPreconditioner
+    : public DiscreteExteriorCalculusMultigrid<TCalculus>
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef DiscreteExteriorCalculusMultigrid<TCalculus> Multigrid;
+    typedef typename Multigrid::DenseVector DenseVector;
+
+    /**
+     * Approximately solves the problem with one V-cycle, starting from zero.
+     * @param input right hand side.
+     * @return approximate solution.
+     */
+    DenseVector solve(const DenseVector& input) const;
+
+  }; // end of class DiscreteExteriorCalculusMultigridPreconditioner
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DiscreteExteriorCalculusMultigrid'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DiscreteExteriorCalculusMultigrid' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TCalculus>
+  std::ostream&
+  operator<<(std::ostream& out, const DiscreteExteriorCalculusMultigrid<TCalculus>& object);
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/dec/DiscreteExteriorCalculusMultigrid.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DiscreteExteriorCalculusMultigrid_h
+
+#undef DiscreteExteriorCalculusMultigrid_RECURSES
+#endif // else defined(DiscreteExteriorCalculusMultigrid_RECURSES)
@@ -41,9 +41,14 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <type_traits>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/base/Clone.h"
+#include "DGtal/base/Clock.h"
 #include "DGtal/dec/KForm.h"
 #include "DGtal/dec/LinearOperator.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -51,6 +56,9 @@
 namespace DGtal
 {
 
+  template <typename TCalculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  class MatrixFreeLinearOperator;
+
   /////////////////////////////////////////////////////////////////////////////
   // template class DiscreteExteriorCalculusSolver
   /**
@@ -58,6 +66,20 @@ namespace DGtal
    * \brief Aim:
    * This wraps a linear algebra solver around a discrete exterior calculus.
    *
+   * Repeated solves, as in time stepping or eigen problems, are
+   * supported by update, which only refactorizes the operator when its
+   * sparsity pattern did not change, by multiple right hand sides
+   * solves, and by warm started solves for iterative solvers (see
+   * solveWithGuess and solveWarmStarted). Time spent in analyses,
+   * factorizations and warm started solves is accumulated in
+   * statistics().
+   *
+   * The const solve and solveWithGuess methods do not modify the
+   * solver, so that direct solvers may solve several inputs
+   * concurrently. They time their solve phase in a Statistics given
+   * by the caller, if any. solveWarmStarted keeps the last solution
+   * and updates statistics, hence is not const.
+   *
    * @tparam TCalculus should be DiscreteExteriorCalculus.
    * @tparam TLinearAlgebraSolver should be a model of CLinearAlgebraSolver.
    * @tparam order_in is the input order of the linear problem.
@@ -79,8 +101,33 @@ namespace DGtal
     typedef TLinearAlgebraSolver LinearAlgebraSolver;
 
     typedef LinearOperator<Calculus, order_in, duality_in, order_out, duality_out> Operator;
+    typedef MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out> MatrixFreeOperator;
     typedef KForm<Calculus, order_in, duality_in> SolutionKForm;
     typedef KForm<Calculus, order_out, duality_out> InputKForm;
+    typedef std::vector<SolutionKForm> SolutionKForms;
+    typedef std::vector<InputKForm> InputKForms;
+
+    typedef typename Calculus::DenseVector DenseVector;
+    typedef typename Calculus::DenseMatrix DenseMatrix;
+    typedef typename Calculus::SparseMatrix SparseMatrix;
+
+    /**
+     * Counts and times (in ms) of the solver phases, accumulated since
+     * construction or the last call to resetStatistics. The solver
+     * only counts the solves of solveWarmStarted, const solves are
+     * counted in the Statistics given to them.
+     */
+    struct Statistics
+    {
+      Statistics();
+      unsigned int nb_analyses;
+      unsigned int nb_factorizations;
+      unsigned int nb_solves;
+      unsigned int nb_right_hand_sides;
+      double analyze_time;
+      double factorize_time;
+      double solve_time;
+    };
 
     /**
      * Constructor.
@@ -107,17 +154,99 @@ namespace DGtal
 
     /**
      * Prefactorize problem / set problem operator.
+     * The sparsity pattern is not recorded, so a following update
+     * analyzes the pattern again.
      * @param linear_operator linear operator.
      * @return *this.
      */
     DiscreteExteriorCalculusSolver& compute(const Operator& linear_operator);
 
+    /**
+     * Set problem matrix-free operator, for matrix-free iterative solvers
+     * (e.g. MatrixFreeOperator::SolverConjugateGradient).
+     * The solver keeps a reference on the operator, which should outlive it.
+     * @param linear_operator matrix-free linear operator.
+     * @return *this.
+     */
+    DiscreteExteriorCalculusSolver& compute(const MatrixFreeOperator& linear_operator);
+
+    /**
+     * Symbolic factorization of the problem operator, which only
+     * depends on its sparsity pattern.
+     * Requires a solver with analyzePattern, such as Eigen solvers.
+     * @param linear_operator linear operator.
+     * @return *this.
+     */
+    DiscreteExteriorCalculusSolver& analyzePattern(const Operator& linear_operator);
+
+    /**
+     * Numerical factorization of the problem operator, reusing the
+     * last symbolic factorization. If the sparsity pattern of the
+     * operator differs from the analyzed one, or if none was analyzed,
+     * it is analyzed first.
+     * Requires a solver with analyzePattern and factorize, such as Eigen solvers.
+     * @param linear_operator linear operator.
+     * @return *this.
+     */
+    DiscreteExteriorCalculusSolver& factorize(const Operator& linear_operator);
+
+    /**
+     * Sets a new problem operator, reusing the symbolic factorization
+     * of the previous operator when the sparsity pattern is unchanged.
+     * Requires a solver with analyzePattern and factorize.
+     * @param linear_operator linear operator.
+     * @return *this.
+     */
+    DiscreteExteriorCalculusSolver& update(const Operator& linear_operator);
+
     /**
      * Solve prefactorized / set problem input.
      * @param input_kform input k-form.
+     * @param statistics if not NULL, the solve is counted and timed in it.
+     * @return problem solution.
+     */
+    SolutionKForm solve(const InputKForm& input_kform, Statistics* statistics = NULL) const;
+
+    /**
+     * Solve prefactorized / set problem for several inputs at once.
+     * Inputs are gathered as the columns of a dense matrix, which lets
+     * direct solvers share the triangular sweeps.
+     * @param input_kforms input k-forms.
+     * @param statistics if not NULL, the solve is counted and timed in it.
+     * @return problem solutions, in the same order.
+     */
+    SolutionKForms solve(const InputKForms& input_kforms, Statistics* statistics = NULL) const;
+
+    /**
+     * Solve set problem with an iterative solver, starting from a guess.
+     * Requires a solver with solveWithGuess, such as Eigen iterative solvers.
+     * @param input_kform input k-form.
+     * @param guess_kform initial guess.
+     * @param statistics if not NULL, the solve is counted and timed in it.
      * @return problem solution.
      */
-    SolutionKForm solve(const InputKForm& input_kform) const;
+    SolutionKForm solveWithGuess(const InputKForm& input_kform, const SolutionKForm& guess_kform, Statistics* statistics = NULL) const;
+
+    /**
+     * Solve set problem with an iterative solver, starting from the
+     * solution of the previous call, or from zero for the first one.
+     * The solution is kept for the next call, and the solve is counted
+     * in statistics.
+     * Requires a solver with solveWithGuess, such as Eigen iterative solvers.
+     * @param input_kform input k-form.
+     * @return problem solution.
+     */
+    SolutionKForm solveWarmStarted(const InputKForm& input_kform);
+
+    /**
+     * @return counts and times of the solver phases.
+     */
+    const Statistics& statistics() const;
+
+    /**
+     * Resets counts and times of the solver phases.
+     */
+    void resetStatistics();
 
     /**
      * Checks the validity/consistency of the object.
@@ -128,12 +257,51 @@ namespace DGtal
     // ------------------------- Private Datas --------------------------------
   private:
 
+    /**
+     * Type of the compressed storage indexes (SparseMatrix::StorageIndex since Eigen 3.3).
+     */
+    typedef typename std::remove_reference<decltype(*std::declval<SparseMatrix&>().outerIndexPtr())>::type StorageIndex;
+
+    /**
+     * Sparsity pattern of the last analyzed operator.
+     */
+    std::vector<StorageIndex> myPatternOuterIndexes;
+    std::vector<StorageIndex> myPatternInnerIndexes;
+    typename SparseMatrix::Index myPatternRows;
+    bool myHasPattern;
+
+    /**
+     * Solution of the last warm started solve.
+     */
+    DenseVector myLastSolution;
+
+    /**
+     * Counts and times of the solver phases.
+     */
+    Statistics myStatistics;
+
     // ------------------------- Hidden services ------------------------------
   protected:
 
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+     * Stores the sparsity pattern of matrix.
+     */
+    void setPattern(const SparseMatrix& matrix);
+
+    /**
+     * @return true if matrix has the stored sparsity pattern.
+     */
+    bool hasPattern(const SparseMatrix& matrix) const;
+
+    /**
+     * Counts a solve of nb_right_hand_sides inputs that took time ms
+     * in statistics, if not NULL.
+     */
+    static void countSolve(Statistics* statistics, double time, std::size_t nb_right_hand_sides);
+
   }; // end of class DiscreteExteriorCalculusSolver
 
 
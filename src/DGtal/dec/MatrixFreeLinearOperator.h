@@ -0,0 +1,482 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MatrixFreeLinearOperator.h
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module MatrixFreeLinearOperator.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MatrixFreeLinearOperator_RECURSES)
+#error Recursive header files inclusion detected in MatrixFreeLinearOperator.h
+#else // defined(MatrixFreeLinearOperator_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MatrixFreeLinearOperator_RECURSES
+
+#if !defined MatrixFreeLinearOperator_h
+/** Prevents repeated inclusion of headers. */
+#define MatrixFreeLinearOperator_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/CountedPtr.h"
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/Duality.h"
+#include "DGtal/dec/KForm.h"
+//////////////////////////////////////////////////////////////////////////////
+
+#if !EIGEN_VERSION_AT_LEAST(3,3,0)
+#error MatrixFreeLinearOperator requires Eigen 3.3 or later (matrix-free solvers).
+#endif
+
+namespace DGtal
+{
+  template <typename TCalculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  class MatrixFreeLinearOperator;
+} // namespace DGtal
+
+namespace Eigen
+{
+  namespace internal
+  {
+    /// Matrix-free operators are seen by Eigen as sparse matrices.
+    template <typename TCalculus, DGtal::Order order_in, DGtal::Duality duality_in, DGtal::Order order_out, DGtal::Duality duality_out>
+    struct traits< DGtal::MatrixFreeLinearOperator<TCalculus, order_in, duality_in, order_out, duality_out> >
+      : public Eigen::internal::traits< Eigen::SparseMatrix<double> >
+    {};
+  } // namespace internal
+} // namespace Eigen
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MatrixFreeFactor
+  /**
+   * Description of template class 'MatrixFreeFactor' <p>
+   * \brief Aim:
+   * Elementary factor of a MatrixFreeLinearOperator, either an
+   * incidence factor, which stores the indexes and signs of the input
+   * cells incident to each output cell, or a diagonal factor.
+   *
+   * @tparam TCalculus should be DiscreteExteriorCalculus with EigenLinearAlgebraBackend.
+   */
+  template <typename TCalculus>
+  struct MatrixFreeFactor
+  {
+    typedef TCalculus Calculus;
+    typedef typename Calculus::Scalar Scalar;
+    typedef typename Calculus::Index Index;
+    typedef typename Calculus::DenseVector DenseVector;
+    typedef DGtal::int32_t StorageIndex;
+
+    /// number of output values.
+    Index rows;
+    /// number of input values.
+    Index cols;
+    /// entries of row r of an incidence factor are entries starts[r] .. starts[r+1]-1.
+    std::vector<Index> starts;
+    /// input index of each entry of an incidence factor.
+    std::vector<StorageIndex> indexes;
+    /// sign of each entry of an incidence factor.
+    std::vector<signed char> signs;
+    /// diagonal of a diagonal factor, empty for incidence factors.
+    std::vector<Scalar> diagonal;
+
+    /**
+     * Applies the factor.
+     * @param input input values.
+     * @param[out] output output values.
+     */
+    void apply(const DenseVector& input, DenseVector& output) const;
+  };
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MatrixFreeLinearOperator
+  /**
+   * Description of template class 'MatrixFreeLinearOperator' <p>
+   * \brief Aim:
+   * MatrixFreeLinearOperator represents a discrete linear operator
+   * between discrete kforms in the DEC package, like LinearOperator,
+   * but without materializing its sparse matrix.
+   *
+   * The operator is a sum of terms, each term being a scalar times a
+   * chain of elementary factors: incidence factors (derivatives),
+   * which store for each output cell the indexes and signs of its
+   * incident input cells, and diagonal factors (hodges). Composite
+   * operators like the laplace ad*d are never multiplied out, hence
+   * they use several times less memory than their Eigen sparse
+   * matrices. Factors are shared between operators and applied by
+   * sweeps over output cells, in parallel if DGtal has been built
+   * with OpenMP support (WITH_OPENMP flag set to "true").
+   *
+   * Operators are built by MatrixFreeOperatorFactory and combined
+   * with +, -, scalar and operator products, like LinearOperator. They
+   * are models of Eigen matrix-free operators, hence they can be
+   * used with the iterative solvers SolverConjugateGradient and
+   * SolverBiCGSTAB, directly or through
+   * DiscreteExteriorCalculusSolver. Solvers keep a reference on the
+   * operator, which should outlive them.
+   *
+   * @code
+   * typedef MatrixFreeOperatorFactory<Calculus> Factory;
+   * typedef MatrixFreeLinearOperator<Calculus, 0, PRIMAL, 0, PRIMAL> Operator;
+   * const Operator laplace = Factory::laplace<PRIMAL>(calculus) - 0.01 * Factory::identity<0, PRIMAL>(calculus);
+   * DiscreteExteriorCalculusSolver<Calculus, Operator::SolverBiCGSTAB, 0, PRIMAL, 0, PRIMAL> solver;
+   * solver.compute(laplace);
+   * const Calculus::PrimalForm0 solution = solver.solve(input);
+   * @endcode
+   *
+   * @tparam TCalculus should be DiscreteExteriorCalculus with EigenLinearAlgebraBackend.
+   * @tparam order_in is the input order of the linear operator.
+   * @tparam duality_in is the input duality of the linear operator.
+   * @tparam order_out is the output order of the linear operator.
+   * @tparam duality_out is the output duality of the linear operator.
+   */
+  template <typename TCalculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  class MatrixFreeLinearOperator
+    : public Eigen::EigenBase< MatrixFreeLinearOperator<TCalculus, order_in, duality_in, order_out, duality_out> >
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef TCalculus Calculus;
+    typedef MatrixFreeLinearOperator<TCalculus, order_in, duality_in, order_out, duality_out> Self;
+
+    BOOST_STATIC_ASSERT(( order_in >= 0 ));
+    BOOST_STATIC_ASSERT(( order_in <= Calculus::dimensionEmbedded ));
+    BOOST_STATIC_ASSERT(( order_out >= 0 ));
+    BOOST_STATIC_ASSERT(( order_out <= Calculus::dimensionEmbedded ));
+
+    ///Calculus scalar type
+    typedef typename Calculus::Scalar Scalar;
+    typedef Scalar RealScalar;
+    typedef typename Calculus::Index Index;
+    typedef typename MatrixFreeFactor<Calculus>::StorageIndex StorageIndex;
+    typedef typename Calculus::DenseVector DenseVector;
+    enum
+    {
+      ColsAtCompileTime = Eigen::Dynamic,
+      MaxColsAtCompileTime = Eigen::Dynamic,
+      IsRowMajor = false
+    };
+
+    ///Input KForm type
+    typedef KForm<Calculus, order_in, duality_in> InputKForm;
+    ///Output KForm type
+    typedef KForm<Calculus, order_out, duality_out> OutputKForm;
+
+    ///Matrix-free conjugate gradient solver, for symmetric definite operators.
+    typedef Eigen::ConjugateGradient<Self, Eigen::Lower|Eigen::Upper, Eigen::IdentityPreconditioner> SolverConjugateGradient;
+    ///Matrix-free biconjugate gradient stabilized solver.
+    typedef Eigen::BiCGSTAB<Self, Eigen::IdentityPreconditioner> SolverBiCGSTAB;
+
+    /// Elementary factor of an operator.
+    typedef MatrixFreeFactor<Calculus> Factor;
+
+    /// Chain of factors, the first one being applied first.
+    typedef std::vector< CountedPtr<Factor> > Factors;
+
+    /// Term of an operator.
+    struct Term
+    {
+      Scalar coefficient;
+      Factors factors;
+    };
+
+    typedef std::vector<Term> Terms;
+
+    /**
+     * Constructor. The operator is null.
+     * @param calculus the discrete exterior calculus to use.
+     */
+    MatrixFreeLinearOperator(ConstAlias<Calculus> calculus);
+
+    /**
+     * Constructor.
+     * @param calculus the discrete exterior calculus to use.
+     * @param terms the terms of the operator.
+     */
+    MatrixFreeLinearOperator(ConstAlias<Calculus> calculus, const Terms& terms);
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Terms of the operator.
+     */
+    Terms myTerms;
+
+    /**
+     * Pointer to const calculus.
+     */
+    const Calculus* myCalculus;
+
+    /// @return the number of output values.
+    Index rows() const;
+
+    /// @return the number of input values.
+    Index cols() const;
+
+    /**
+     * Applies the operator.
+     * @param input input values.
+     * @param[out] output output values.
+     */
+    void apply(const DenseVector& input, DenseVector& output) const;
+
+    /**
+     * Product with an Eigen dense vector, used by Eigen iterative solvers.
+     * @param input input values.
+     * @return the product expression.
+     */
+    template <typename Rhs>
+    Eigen::Product<Self, Rhs, Eigen::AliasFreeProduct>
+    operator*(const Eigen::MatrixBase<Rhs>& input) const;
+
+    /**
+     * @return the number of entries stored by the distinct factors of
+     * the operator (incidence entries and diagonal values).
+     */
+    Index nbStoredEntries() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay(std::ostream& out) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    MatrixFreeLinearOperator();
+
+  }; // end of class MatrixFreeLinearOperator
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MatrixFreeLinearOperator'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MatrixFreeLinearOperator' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Calculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  std::ostream&
+  operator<<(std::ostream& out,
+             const MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>& object);
+
+  /**
+   * Overloads 'operator+' for adding objects of class 'MatrixFreeLinearOperator'.
+   * @param linear_operator_a left operant
+   * @param linear_operator_b right operant
+   * @return linear_operator_a + linear_operator_b.
+   */
+  template <typename Calculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>
+  operator+(const MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>& linear_operator_a,
+            const MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>& linear_operator_b);
+
+  /**
+   * Overloads 'operator-' for substracting objects of class 'MatrixFreeLinearOperator'.
+   * @param linear_operator_a left operant
+   * @param linear_operator_b right operant
+   * @return linear_operator_a - linear_operator_b.
+   */
+  template <typename Calculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>
+  operator-(const MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>& linear_operator_a,
+            const MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>& linear_operator_b);
+
+  /**
+   * Overloads 'operator*' for scalar multiplication of objects of class 'MatrixFreeLinearOperator'.
+   * @param scalar left operant
+   * @param linear_operator right operant
+   * @return scalar * linear_operator.
+   */
+  template <typename Calculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>
+  operator*(const typename Calculus::Scalar& scalar,
+            const MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>& linear_operator);
+
+  /**
+   * Overloads 'operator*' for internal multiplication of objects of class 'MatrixFreeLinearOperator'.
+   * Factors are shared, not multiplied out.
+   * @param operator_left left operant
+   * @param operator_right right operant
+   * @return operator_left * operator_right.
+   */
+  template <typename Calculus, Order order_in, Duality duality_in, Order order_fold, Duality duality_fold, Order order_out, Duality duality_out>
+  MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>
+  operator*(const MatrixFreeLinearOperator<Calculus, order_fold, duality_fold, order_out, duality_out>& operator_left,
+            const MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_fold, duality_fold>& operator_right);
+
+  /**
+   * Overloads 'operator*' for application of objects of class 'MatrixFreeLinearOperator' on objects of class 'KForm'.
+   * @param linear_operator left operant
+   * @param input_form right operant
+   * @return linear_operator * input_form.
+   */
+  template <typename Calculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  KForm<Calculus, order_out, duality_out>
+  operator*(const MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>& linear_operator,
+            const KForm<Calculus, order_in, duality_in>& input_form);
+
+  /**
+   * Overloads 'operator-' for unary additive inverse of objects of class 'MatrixFreeLinearOperator'.
+   * @param linear_operator operant
+   * @return -linear_operator.
+   */
+  template <typename Calculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>
+  operator-(const MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>& linear_operator);
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MatrixFreeOperatorFactory
+  /**
+   * Description of template class 'MatrixFreeOperatorFactory' <p>
+   * \brief Aim:
+   * This class provides static members to create the matrix-free
+   * operators of a discrete exterior calculus, with the same
+   * conventions as the operators of DiscreteExteriorCalculus.
+   *
+   * @tparam TCalculus should be DiscreteExteriorCalculus with EigenLinearAlgebraBackend.
+   */
+  template <typename TCalculus>
+  class MatrixFreeOperatorFactory
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef TCalculus Calculus;
+    typedef typename Calculus::Scalar Scalar;
+    typedef typename Calculus::Index Index;
+
+    /**
+     * Identity operator from order-forms to order-forms.
+     * @param calculus the discrete exterior calculus to use.
+     */
+    template <Order order, Duality duality>
+    static
+    MatrixFreeLinearOperator<Calculus, order, duality, order, duality>
+    identity(ConstAlias<Calculus> calculus);
+
+    /**
+     * Derivative operator from order-forms to (order+1)-forms.
+     * @param calculus the discrete exterior calculus to use.
+     */
+    template <Order order, Duality duality>
+    static
+    MatrixFreeLinearOperator<Calculus, order, duality, order+1, duality>
+    derivative(ConstAlias<Calculus> calculus);
+
+    /**
+     * Antiderivative operator from order-forms to (order-1)-forms.
+     * @param calculus the discrete exterior calculus to use.
+     */
+    template <Order order, Duality duality>
+    static
+    MatrixFreeLinearOperator<Calculus, order, duality, order-1, duality>
+    antiderivative(ConstAlias<Calculus> calculus);
+
+    /**
+     * Laplace operator from duality 0-forms to duality 0-forms.
+     * @param calculus the discrete exterior calculus to use.
+     */
+    template <Duality duality>
+    static
+    MatrixFreeLinearOperator<Calculus, 0, duality, 0, duality>
+    laplace(ConstAlias<Calculus> calculus);
+
+    /**
+     * Hodge operator from duality order-form to opposite duality (dimEmbedded-order)-forms.
+     * @param calculus the discrete exterior calculus to use.
+     */
+    template <Order order, Duality duality>
+    static
+    MatrixFreeLinearOperator<Calculus, order, duality, Calculus::dimensionEmbedded-order, OppositeDuality<duality>::duality>
+    hodge(ConstAlias<Calculus> calculus);
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Constructor.
+     * Forbidden by default.
+     */
+    MatrixFreeOperatorFactory();
+
+  }; // end of class MatrixFreeOperatorFactory
+
+} // namespace DGtal
+
+namespace Eigen
+{
+  namespace internal
+  {
+    /// Product of a matrix-free operator with a dense vector, used by Eigen iterative solvers.
+    template <typename TCalculus, DGtal::Order order_in, DGtal::Duality duality_in, DGtal::Order order_out, DGtal::Duality duality_out, typename Rhs>
+    struct generic_product_impl< DGtal::MatrixFreeLinearOperator<TCalculus, order_in, duality_in, order_out, duality_out>, Rhs, SparseShape, DenseShape, GemvProduct >
+      : generic_product_impl_base< DGtal::MatrixFreeLinearOperator<TCalculus, order_in, duality_in, order_out, duality_out>, Rhs,
+                                   generic_product_impl< DGtal::MatrixFreeLinearOperator<TCalculus, order_in, duality_in, order_out, duality_out>, Rhs > >
+    {
+      typedef DGtal::MatrixFreeLinearOperator<TCalculus, order_in, duality_in, order_out, duality_out> Operator;
+      typedef typename Product<Operator, Rhs>::Scalar Scalar;
+
+      template <typename Dest>
+      static void scaleAndAddTo(Dest& dst, const Operator& lhs, const Rhs& rhs, const Scalar& alpha)
+      {
+        const typename Operator::DenseVector input = rhs;
+        typename Operator::DenseVector output;
+        lhs.apply(input, output);
+        dst += alpha * output;
+      }
+    };
+  } // namespace internal
+} // namespace Eigen
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/dec/MatrixFreeLinearOperator.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MatrixFreeLinearOperator_h
+
+#undef MatrixFreeLinearOperator_RECURSES
+#endif // else defined(MatrixFreeLinearOperator_RECURSES)
@@ -41,6 +41,8 @@
 #include <iostream>
 #include <exception>
 #include <iomanip>
+#include <vector>
+#include <array>
 #include "DGtal/base/Common.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -197,6 +199,43 @@ namespace DGtal
        */
       DSLSubsegment(Number alpha, Number beta, Point &A, Point &B, Number precision = 1e-10);
 
+      /**
+       * A subsegment query: the DSL 0 <= ax -by + mu < b and the two
+       * points A and B of this DSL delimiting the subsegment.
+       */
+      struct Query
+      {
+        Number a;
+        Number b;
+        Number mu;
+        Point A;
+        Point B;
+      };
+
+      /**
+       * Minimal characteristics (a,b,mu) of a subsegment.
+       */
+      typedef std::array<Integer,3> Characteristics;
+
+      /**
+       * Computes the minimal characteristics of a batch of subsegments
+       * with the Farey fan algorithm (integer input parameters only).
+       * The queries are grouped by slope and length, so that the
+       * ladder of the Farey fan, which only depends on them, is
+       * computed once per group. If DGtal has been built with OpenMP
+       * support (WITH_OPENMP flag set to "true"), the groups are
+       * processed in parallel. The result does not depend on the
+       * number of threads.
+       * @param [in] queries the subsegment queries
+       * @param [out] results the minimal characteristics of the
+       * subsegments, in the order of the queries
+       * @param [in] chunkSize maximal number of queries processed by a
+       * thread at once
+       */
+      static void computeBatch(const std::vector<Query> &queries,
+                               std::vector<Characteristics> &results,
+                               std::size_t chunkSize = 1024);
+
 
   protected:
       /**
@@ -210,6 +249,38 @@ namespace DGtal
       */
       void DSLSubsegmentFareyFan(Number a, Number b, Number mu, Point &A, Point &B);
 
+      /**
+       * Computes the ladder of the Farey fan used by the Farey fan
+       * algorithm, ie. the two consecutive fractions fp/fq <= a/b <
+       * gp/gq of the Farey series of order n (or the convex hull
+       * vertices when b > n). Only depends on the slope and the length.
+       * @param a DSL a parameter
+       * @param b DSL b parameter
+       * @param n length of the subsegment
+       * @param fp (returned) numerator of the lower fraction
+       * @param fq (returned) denominator of the lower fraction
+       * @param gp (returned) numerator of the upper fraction
+       * @param gq (returned) denominator of the upper fraction
+       */
+      void fareyFanLadder(Number a, Number b, Integer n,
+                          Integer *fp, Integer *fq, Integer *gp, Integer *gq);
+
+      /**
+       * Second step of the Farey fan algorithm: localizes the DSL in
+       * the ladder and sets (myA,myB,myMu).
+       * @param a DSL a parameter
+       * @param b DSL b parameter
+       * @param mu DSL mu parameter
+       * @param A left-most point
+       * @param n length of the subsegment (must be lower than 2b)
+       * @param fp numerator of the lower fraction of the ladder
+       * @param fq denominator of the lower fraction of the ladder
+       * @param gp numerator of the upper fraction of the ladder
+       * @param gq denominator of the upper fraction of the ladder
+       */
+      void fareyFanSolve(Number a, Number b, Number mu, const Point &A, Integer n,
+                         Integer fp, Integer fq, Integer gp, Integer gq);
+
       /**
        * Function called by the constructor when the input parameters
        * are integers and the local convex hull algorithm is used.
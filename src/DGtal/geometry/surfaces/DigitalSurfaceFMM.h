@@ -0,0 +1,330 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSurfaceFMM.h
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module DigitalSurfaceFMM.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSurfaceFMM_RECURSES)
+#error Recursive header files inclusion detected in DigitalSurfaceFMM.h
+#else // defined(DigitalSurfaceFMM_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSurfaceFMM_RECURSES
+
+#if !defined DigitalSurfaceFMM_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSurfaceFMM_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <limits>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/FrozenDigitalSurface.h"
+#include "DGtal/topology/IndexedDigitalSurface.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSurfaceFMM
+  /**
+     Description of template class 'DigitalSurfaceFMM' <p> \brief Aim:
+     Fast Marching Method (FMM) computing geodesic distances on a
+     digital surface, from one or several sources.
+
+     Surfels are embedded (e.g. at their centroid with a
+     CanonicSCellEmbedder) and the surface is seen as a polygonal mesh
+     whose faces are the umbrellas of the digital surface. The
+     distance of a surfel \a v is updated from each corner (\a u, \a v,
+     \a w) of the faces around \a v, \a u and \a w being the neighbors
+     of \a v along the face, by computing the arrival time of a planar
+     front through the triangle (\a u, \a v, \a w) (Kimmel and
+     Sethian's first order update), or from the neighbors of \a v
+     along arcs when the front does not cross the triangle. Distances
+     are thus consistent with the Euclidean metric, which is not the
+     case of graph distances along arcs.
+
+     Each vertex is labelled with the index of its closest source,
+     hence computing the distance from several sources gives their
+     geodesic Voronoi diagram on the surface. The computation may be
+     restricted to the vertices closer than some maximal distance
+     (e.g. geodesic patches around a surfel).
+
+     Two algorithms compute the same distances:
+
+     - compute() is the sequential Fast Marching Method, vertices
+       being accepted in increasing order of distance.
+
+     - parallelCompute() updates all the vertices of a narrow band
+       (the neighbors of the vertices whose distance has changed) at
+       once, in parallel if DGtal has been built with OpenMP support
+       (WITH_OPENMP flag set to "true"), until no distance changes
+       (Jeong and Whitaker's Fast Iterative Method). Each iteration
+       only reads the distances of the previous one, hence the result
+       does not depend on the number of threads.
+
+     @code
+     typedef DigitalSetBoundary<KSpace,DigitalSet> Container;
+     typedef FrozenDigitalSurface<Container> Frozen;
+     Frozen frozen( surface );
+     DigitalSurfaceFMM<Container> fmm;
+     fmm.init( frozen, CanonicSCellEmbedder<KSpace>( K ) );
+     std::vector<Frozen::Vertex> sources;
+     sources.push_back( 0 );
+     fmm.parallelCompute( sources.begin(), sources.end() );
+     std::cout << fmm.distance( 10 ) << std::endl;
+     @endcode
+
+     @tparam TDigitalSurfaceContainer any model of
+     concepts::CDigitalSurfaceContainer.
+
+     @see FMM for distances in digital domains.
+   */
+  template <typename TDigitalSurfaceContainer>
+  class DigitalSurfaceFMM
+  {
+  public:
+    typedef TDigitalSurfaceContainer DigitalSurfaceContainer;
+    typedef DigitalSurfaceFMM<DigitalSurfaceContainer> Self;
+    typedef FrozenDigitalSurface<DigitalSurfaceContainer> Frozen;
+    typedef IndexedDigitalSurface<DigitalSurfaceContainer> Indexed;
+    typedef typename Frozen::KSpace KSpace;
+    typedef typename KSpace::Space::RealPoint RealPoint;
+    /// Type of distances.
+    typedef double Scalar;
+    /// Type of index of vertices and sources.
+    typedef std::size_t Index;
+    /// A vertex is the index of a surfel, as in Frozen or Indexed.
+    typedef Index Vertex;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Constructor. The surface is empty.
+    */
+    DigitalSurfaceFMM();
+
+    /**
+       Initializes the geometry from a frozen digital surface, which
+       may be open. Distances are reset.
+
+       @tparam SCellEmbedder any model of CSCellEmbedder.
+       @param surface any frozen digital surface.
+       @param embedder the embedder of surfels.
+    */
+    template <typename SCellEmbedder>
+    void init( const Frozen & surface, const SCellEmbedder & embedder );
+
+    /**
+       Initializes the geometry from an indexed (closed) digital
+       surface. Distances are reset.
+
+       @tparam SCellEmbedder any model of CSCellEmbedder.
+       @param surface any indexed digital surface.
+       @param embedder the embedder of surfels.
+    */
+    template <typename SCellEmbedder>
+    void init( const Indexed & surface, const SCellEmbedder & embedder );
+
+    // ----------------------- Distance services ------------------------------
+  public:
+
+    /**
+       Computes the distances to the given sources with the sequential
+       Fast Marching Method.
+
+       @tparam VertexIterator any type of single pass iterator on vertices.
+       @param b the begin iterator in a container of sources.
+       @param e the end iterator in a container of sources.
+       @param maxDistance vertices farther than this distance are not
+       reached.
+    */
+    template <typename VertexIterator>
+    void compute( VertexIterator b, VertexIterator e,
+                  Scalar maxDistance = infinity() );
+
+    /**
+       Computes the distances to the given sources by updating narrow
+       bands in parallel until convergence.
+
+       @tparam VertexIterator any type of single pass iterator on vertices.
+       @param b the begin iterator in a container of sources.
+       @param e the end iterator in a container of sources.
+       @param maxDistance vertices farther than this distance are not
+       reached.
+    */
+    template <typename VertexIterator>
+    void parallelCompute( VertexIterator b, VertexIterator e,
+                          Scalar maxDistance = infinity() );
+
+    /// @return the number of vertices.
+    Index nbVertices() const;
+
+    /// @return the number of sources of the last computation.
+    Index nbSources() const;
+
+    /**
+       @param v any vertex.
+       @return its embedding.
+    */
+    const RealPoint & position( Vertex v ) const;
+
+    /**
+       @param v any vertex.
+       @return 'true' if \a v has been reached by the last computation.
+    */
+    bool isReached( Vertex v ) const;
+
+    /**
+       @param v any vertex.
+       @return its geodesic distance to the closest source, or
+       infinity() if it has not been reached.
+    */
+    Scalar distance( Vertex v ) const;
+
+    /// @return the distances of all the vertices.
+    const std::vector<Scalar> & distances() const;
+
+    /**
+       @param v any vertex.
+       @return the index (in the range of sources) of the closest
+       source of \a v, or noLabel() if it has not been reached.
+    */
+    Index label( Vertex v ) const;
+
+    /// @return the labels of all the vertices.
+    const std::vector<Index> & labels() const;
+
+    /// @return the distance of the vertices that are not reached.
+    static Scalar infinity();
+
+    /// @return the label of the vertices that are not reached.
+    static Index noLabel();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// A corner (u,w) of a vertex v, u and w being its neighbors along a face.
+    typedef std::pair<Index,Index> Corner;
+
+    /// the embedding of each vertex.
+    std::vector<RealPoint> myPositions;
+    /// the neighbors of vertex v are myNeighbors[ myNeighborStarts[ v ] .. myNeighborStarts[ v + 1 ] - 1 ].
+    std::vector<Index> myNeighborStarts;
+    /// the neighbors of all the vertices.
+    std::vector<Index> myNeighbors;
+    /// the corners of vertex v are myCorners[ myCornerStarts[ v ] .. myCornerStarts[ v + 1 ] - 1 ].
+    std::vector<Index> myCornerStarts;
+    /// the corners of all the vertices.
+    std::vector<Corner> myCorners;
+    /// the distance of each vertex.
+    std::vector<Scalar> myDistances;
+    /// the closest source of each vertex.
+    std::vector<Index> myLabels;
+    /// the number of sources.
+    Index myNbSources;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       Resets distances and labels, then sets the sources.
+       @return the sources, each one only once.
+    */
+    template <typename VertexIterator>
+    std::vector<Vertex> initSources( VertexIterator b, VertexIterator e );
+
+    /**
+       Computes the distance of a vertex from its neighbors.
+
+       @param v any vertex.
+       @param usable when non null, only the neighbors marked in this
+       array are used, otherwise all the neighbors that are reached.
+       @param[out] label the label of the neighbor(s) giving the distance.
+       @return the new distance of \a v (infinity() if no neighbor is usable).
+    */
+    Scalar localUpdate( Vertex v, const std::vector<unsigned char> * usable,
+                        Index & label ) const;
+
+    /**
+       Arrival time at \a c of a planar front going through \a a at
+       time \a ta and \a b at time \a tb.
+       @return the time, or infinity() if the front does not cross
+       the triangle (\a a, \a b, \a c) before reaching \a c.
+    */
+    static Scalar triangleUpdate( const RealPoint & c,
+                                  const RealPoint & a, Scalar ta,
+                                  const RealPoint & b, Scalar tb );
+
+    /// Resets distances and labels for the current number of vertices.
+    void resetDistances();
+
+  }; // end of class DigitalSurfaceFMM
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSurfaceFMM'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSurfaceFMM' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDigitalSurfaceContainer>
+  std::ostream&
+  operator<< ( std::ostream & out, const DigitalSurfaceFMM<TDigitalSurfaceContainer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/DigitalSurfaceFMM.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSurfaceFMM_h
+
+#undef DigitalSurfaceFMM_RECURSES
+#endif // else defined(DigitalSurfaceFMM_RECURSES)
@@ -0,0 +1,295 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file CompactSpatialCubicalSubdivision.h
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module CompactSpatialCubicalSubdivision.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(CompactSpatialCubicalSubdivision_RECURSES)
+#error Recursive header files inclusion detected in CompactSpatialCubicalSubdivision.h
+#else // defined(CompactSpatialCubicalSubdivision_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define CompactSpatialCubicalSubdivision_RECURSES
+
+#if !defined CompactSpatialCubicalSubdivision_h
+/** Prevents repeated inclusion of headers. */
+#define CompactSpatialCubicalSubdivision_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CSpace.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class CompactSpatialCubicalSubdivision
+  /**
+     Description of template class 'CompactSpatialCubicalSubdivision' <p> \brief
+     Aim: This class is a data structure that subdivides a rectangular
+     domain into cubical bins of size \f$ r^n \f$ in order to answer
+     proximity queries on a set of points, like
+     SpatialCubicalSubdivision, but with a compact storage (a cell list).
+
+     The points are sorted by bin (counting sort) into one contiguous
+     array, the points of each bin being consecutive. An array of
+     offsets gives for each bin the range of its points. Queries
+     do not copy points: they call a visitor on each point found,
+     with the index of the point in the input range. If DGtal has
+     been built with OpenMP support (WITH_OPENMP flag set to "true"),
+     the construction and the batched k-nearest neighbors queries are
+     done in parallel. The result does not depend on the number of threads.
+
+     Bins are characterized by one Point and are organized as a
+     rectangular domain with lowest bin at coordinates (0,...,0).
+
+     @code
+     typedef CompactSpatialCubicalSubdivision<Z3i::Space> Subdivision;
+     Subdivision subdivision( lo, up, 4 );
+     subdivision.init( points.begin(), points.end() );
+     double sum = 0.0;
+     subdivision.forEachNeighbor( p, 3.5,
+       [&sum, &weights] ( const Z3i::Point& q, Subdivision::Index i )
+       { sum += weights[ i ]; } );
+     @endcode
+
+     @tparam TSpace the digital space, a model of CSpace.
+
+     Model of CopyConstructible and Assignable.
+   */
+  template <typename TSpace>
+  class CompactSpatialCubicalSubdivision
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace< TSpace > ));
+  public:
+    typedef TSpace Space;
+    typedef typename Space::Point Point;
+    typedef typename Space::Vector Vector;
+    typedef typename Point::Coordinate Coordinate;
+    typedef HyperRectDomain<Space> Domain;
+    /// Type of index of points and bins.
+    typedef std::size_t Index;
+    /// Range [first,last) of positions in points().
+    typedef std::pair<Index,Index> IndexRange;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Constructor from rectangular domain given by lowest and uppermost point.
+       The subdivision is empty.
+
+       @param lo the lowest point of the domain of interest.
+       @param up the uppermost point of the domain of interest.
+       @param size the edge size of each cubical bin (an integer >= 1 ).
+    */
+    CompactSpatialCubicalSubdivision( Point lo, Point up, Coordinate size );
+
+    /**
+       Stores the range of points [it, itE), replacing the previous
+       points. If the same point is given several times, there are as
+       many copies of this point into its bin.
+
+       @tparam PointConstIterator the type of const iterator on point.
+       @param it an iterator pointing at the beginning of the range.
+       @param itE an iterator pointing after the end of the range.
+       @pre all the points lie within domain().
+    */
+    template <typename PointConstIterator>
+    void init( PointConstIterator it, PointConstIterator itE );
+
+    /// @return the rectangular domain of interest
+    const Domain& domain() const;
+
+    /// @return the rectangular domain of bins, which is a coarser grid than domain().
+    const Domain& binDomain() const;
+
+    /**
+       @param p any point within domain().
+       @return the bin in which lies \a p.
+    */
+    Point bin( Point p ) const;
+
+    /**
+       @param b any valid bin of binDomain().
+       @return its lowest possible point.
+    */
+    Point lowest( Point b ) const;
+
+    /**
+       @param b any valid bin of binDomain().
+       @return its uppermost possible point.
+    */
+    Point uppermost( Point b ) const;
+
+    /// @return the number of stored points.
+    Index size() const;
+
+    /// @return the stored points, sorted by bin.
+    const std::vector<Point>& points() const;
+
+    /// @return the index in the input range of each point of points().
+    const std::vector<Index>& indices() const;
+
+    /**
+       @param b any valid bin of binDomain().
+       @return the range of the positions in points() of the points of bin \a b.
+    */
+    IndexRange binRange( const Point& b ) const;
+
+    /**
+       Calls \a visitor( q, i ) for each point \a q in the bin domain
+       [\a bin_lo, \a bin_up] (clipped to binDomain()), \a i being the
+       index of \a q in the input range. The points are visited bin by
+       bin, and by increasing index in each bin.
+
+       @tparam Visitor the type of a functor (const Point&, Index) -> void.
+       @param bin_lo the lowest bin of the bin domain.
+       @param bin_up the uppermost bin of the bin domain.
+       @param visitor the functor called on each point.
+    */
+    template <typename Visitor>
+    void forEachPoint( Point bin_lo, Point bin_up, Visitor visitor ) const;
+
+    /**
+       Calls \a visitor( q, i ) for each point \a q whose euclidean
+       distance to \a p is lower or equal to \a radius, \a i being the
+       index of \a q in the input range.
+
+       @tparam Visitor the type of a functor (const Point&, Index) -> void.
+       @param p any point.
+       @param radius the radius of the ball.
+       @param visitor the functor called on each point of the ball.
+    */
+    template <typename Visitor>
+    void forEachNeighbor( const Point& p, double radius, Visitor visitor ) const;
+
+    /**
+       Computes the (at most) \a k nearest stored points, for the
+       euclidean distance, of each point of \a queries. The queries
+       are processed in parallel if DGtal has been built with OpenMP support.
+
+       @param queries the query points, which lie within domain().
+       @param k the number of neighbors.
+       @param[out] result result[j] contains the indices in the input
+       range of the nearest points of queries[j], by increasing distance
+       (ties are broken by increasing index).
+    */
+    void kNearestNeighbors( const std::vector<Point>& queries, Index k,
+                            std::vector< std::vector<Index> >& result ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /// the rectangular domain representing the useful points of the space.
+    Domain myDomain;
+    /// the edge size of each bin.
+    Coordinate mySize;
+    /// the rectangular domain of bins.
+    Domain myBinDomain;
+    /// the points, sorted by bin.
+    std::vector<Point> myPoints;
+    /// the index in the input range of each point of myPoints.
+    std::vector<Index> myIndices;
+    /// the points of the i-th bin are in [myOffsets[i],myOffsets[i+1]).
+    std::vector<Index> myOffsets;
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// a precomputed point to improve performance of uppermost() method.
+    Point myDiag;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       @param b any valid bin of binDomain().
+       @return the linear index of the bin \a b.
+    */
+    Index binIndex( const Point& b ) const;
+
+    /**
+       Collects in \a candidates the points of the bins of the bin
+       domain [\a bin_lo, \a bin_up] that are not in the bin domain
+       [\a inner_lo, \a inner_up], with their squared distance to \a p.
+
+       @param p any point.
+       @param bin_lo the lowest bin of the bin domain (valid).
+       @param bin_up the uppermost bin of the bin domain (valid).
+       @param inner_lo the lowest bin of the excluded bin domain.
+       @param inner_up the uppermost bin of the excluded bin domain.
+       @param[in,out] candidates the pairs (squared distance, index).
+    */
+    void collect( const Point& p, const Point& bin_lo, const Point& bin_up,
+                  const Point& inner_lo, const Point& inner_up,
+                  std::vector< std::pair<double,Index> >& candidates ) const;
+
+  }; // end of class CompactSpatialCubicalSubdivision
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'CompactSpatialCubicalSubdivision'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'CompactSpatialCubicalSubdivision' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const CompactSpatialCubicalSubdivision<TSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/tools/CompactSpatialCubicalSubdivision.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined CompactSpatialCubicalSubdivision_h
+
+#undef CompactSpatialCubicalSubdivision_RECURSES
+#endif // else defined(CompactSpatialCubicalSubdivision_RECURSES)
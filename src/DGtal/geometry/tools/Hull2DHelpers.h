@@ -42,6 +42,7 @@
 
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
+#include <array>
 #include <iostream>
 #include <list>
 #include <vector>
@@ -58,6 +59,7 @@
 #include "DGtal/geometry/tools/determinant/PredicateFromOrientationFunctor2.h"
 #include "DGtal/geometry/tools/determinant/AvnaimEtAl2x2DetSignComputer.h"
 #include "DGtal/geometry/tools/determinant/Simple2x2DetComputer.h"
+#include "DGtal/geometry/tools/determinant/BatchInHalfPlaneBy2x2DetComputer.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -357,6 +359,126 @@ namespace DGtal
 				   OutputIterator res, 
 				   const Predicate& aPredicate ); 
 
+    /**
+     * @brief Procedure that returns four extremal points of 
+     * a set of 2D points given by the range [ @a itb , @a ite ), 
+     * in counter-clockwise order: the lowest leftmost point, 
+     * the rightmost lowest point, the highest rightmost point and 
+     * the leftmost highest point. These points are vertices 
+     * of the convex hull and define the quadrilateral 
+     * used by the Akl-Toussaint heuristic 
+     * [Akl and Toussaint, 1978 : \cite AklToussaint1978]. 
+     * 
+     * @pre the range is not empty. 
+     *
+     * @param itb begin iterator
+     * @param ite end iterator 
+     * @return the four extremal points, which may be equal 
+     * for degenerated sets. 
+     *
+     * @tparam ForwardIterator a model of forward and readable iterator
+     */
+    template <typename ForwardIterator>
+    std::array<typename IteratorCirculatorTraits<ForwardIterator>::Value, 4> 
+    aklToussaintQuadrilateral(const ForwardIterator& itb, 
+			      const ForwardIterator& ite); 
+
+    /**
+     * @brief Procedure that discards the points of the range 
+     * [ @a itb , @a ite ) lying strictly inside a given convex 
+     * quadrilateral, whose vertices are points of the set 
+     * (Akl-Toussaint heuristic). The remaining points, 
+     * which contain all the vertices of the convex hull, 
+     * are written in @a res (in the same order). 
+     *
+     * Points are processed by chunks. If @a aFunctor is a 
+     * BatchInHalfPlaneBy2x2DetComputer, the orientations of 
+     * each chunk with respect to an edge of the quadrilateral 
+     * are computed at once.  
+     *
+     * @param itb begin iterator
+     * @param ite end iterator 
+     * @param res output iterator used to export the remaining points
+     * @param aFunctor an orientation functor, which is 
+     * initialized with the edges of the quadrilateral
+     * @param aQuadrilateral the vertices of the quadrilateral, 
+     * in counter-clockwise order (see Hull2D::aklToussaintQuadrilateral). 
+     * @return output iterator after the last written point. 
+     * 
+     * @tparam ForwardIterator a model of forward and readable iterator
+     * @tparam OutputIterator a model of incrementable and writable iterator   
+     * @tparam Functor a model of COrientationFunctor2
+     */
+    template <typename ForwardIterator, 
+	      typename OutputIterator, 
+	      typename Functor >
+    OutputIterator aklToussaintFilter(const ForwardIterator& itb, 
+				      const ForwardIterator& ite,  
+				      OutputIterator res, 
+				      Functor& aFunctor, 
+				      const std::array<typename Functor::Point, 4>& aQuadrilateral ); 
+
+    /**
+     * @brief Procedure that discards the points of the range 
+     * [ @a itb , @a ite ) lying strictly inside the quadrilateral
+     * returned by Hull2D::aklToussaintQuadrilateral. 
+     * @see Hull2D::aklToussaintFilter
+     * 
+     * @param itb begin iterator
+     * @param ite end iterator 
+     * @param res output iterator used to export the remaining points
+     * @param aFunctor an orientation functor 
+     * @return output iterator after the last written point. 
+     * 
+     * @tparam ForwardIterator a model of forward and readable iterator
+     * @tparam OutputIterator a model of incrementable and writable iterator   
+     * @tparam Functor a model of COrientationFunctor2
+     */
+    template <typename ForwardIterator, 
+	      typename OutputIterator, 
+	      typename Functor >
+    OutputIterator aklToussaintFilter(const ForwardIterator& itb, 
+				      const ForwardIterator& ite,  
+				      OutputIterator res, 
+				      Functor& aFunctor ); 
+
+    /**
+     * @brief Procedure that retrieves the vertices
+     * of the convex hull of a large set of 2D points given by 
+     * the range [ @a itb , @a ite ), by a divide-and-conquer 
+     * approach: 
+     * - the points lying strictly inside the quadrilateral returned 
+     * by Hull2D::aklToussaintQuadrilateral are discarded, 
+     * - the range is split into blocks, whose convex hulls are 
+     * computed independently by Andrew's algorithm, 
+     * - the convex hull of the union of these convex hulls is 
+     * finally computed by Andrew's algorithm. 
+     * 
+     * If DGtal has been built with OpenMP support (WITH_OPENMP flag set 
+     * to "true"), the blocks are processed in parallel. The output is 
+     * the same as the one of Hull2D::andrewConvexHullAlgorithm called 
+     * with PredicateFromOrientationFunctor2<Functor>, ie. the vertices
+     * are counter-clockwise oriented and collinear points are removed. 
+     * 
+     * @param itb begin iterator
+     * @param ite end iterator 
+     * @param res output iterator used to export the retrieved points
+     * @param aFunctor an orientation functor, copied for each block 
+     * @param aBlockSize minimal number of points of a block 
+     * 
+     * @tparam RandomAccessIterator a model of random access and readable iterator
+     * @tparam OutputIterator a model of incrementable and writable iterator   
+     * @tparam Functor a model of COrientationFunctor2
+     */
+    template <typename RandomAccessIterator, 
+	      typename OutputIterator, 
+	      typename Functor >
+    void parallelConvexHullAlgorithm(const RandomAccessIterator& itb, 
+				     const RandomAccessIterator& ite,  
+				     OutputIterator res, 
+				     const Functor& aFunctor, 
+				     std::size_t aBlockSize = 1 << 16 ); 
+
 
     /**
      *  @brief Procedure to compute the convex hull thickness given
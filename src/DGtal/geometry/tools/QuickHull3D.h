@@ -0,0 +1,379 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file QuickHull3D.h
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module QuickHull3D.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(QuickHull3D_RECURSES)
+#error Recursive header files inclusion detected in QuickHull3D.h
+#else // defined(QuickHull3D_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define QuickHull3D_RECURSES
+
+#if !defined QuickHull3D_h
+/** Prevents repeated inclusion of headers. */
+#define QuickHull3D_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <array>
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CSpace.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class QuickHull3D
+  /**
+   * Description of template class 'QuickHull3D' <p>
+   * \brief Aim: Computes the convex hull of a set of 3D lattice points
+   * with the quickhull algorithm [Barber et al., 1996 : \cite BarberDobkinHuhdanpaa1996],
+   * using exact integer predicates.
+   *
+   * All the geometric predicates are computed with integers of type
+   * @a TInternalInteger. If the coordinates of the input points are
+   * bounded by \f$ 2^b \f$ in absolute value, the orientation tests
+   * require integers of \f$ 3b + 5 \f$ bits: \c DGtal::int64_t is
+   * thus exact for coordinates lower than \f$ 2^{19} \f$ and
+   * \c DGtal::BigInteger can be used for greater coordinates.
+   *
+   * Before running quickhull, the points that are not extremal in
+   * their row along the first axis are discarded, since they cannot
+   * be vertices of the convex hull. For digital shapes, only
+   * \f$ O(n^2) \f$ points out of \f$ O(n^3) \f$ remain.
+   * If DGtal has been built with OpenMP support (WITH_OPENMP flag set
+   * to "true"), the assignment of the points to the faces and the
+   * digitization of the convex hull are done in parallel.
+   *
+   * The result is given:
+   * - as a set of facets, obtained by merging the coplanar
+   * triangles computed by quickhull. Each facet is described by its vertices and by an
+   * irreducible integer outward normal \f$ N \f$ and an offset
+   * \f$ c \f$ such that the convex hull is the intersection of the
+   * half-spaces \f$ N \cdot x \leq c \f$.
+   * - as a triangulation of the boundary of the convex hull, whose
+   * triangles are counter-clockwise oriented when seen from outside.
+   * It is obtained by triangulating each facet as a fan, so that
+   * the vertices of the triangles are exactly the vertices of the
+   * convex hull.
+   *
+   * @code
+   QuickHull3D<Z3i::Space> hull;
+   hull.compute( aDigitalSet.begin(), aDigitalSet.end() );
+   trace.info() << hull.nbVertices() << " vertices, "
+                << hull.nbFacets() << " facets" << std::endl;
+   Z3i::DigitalSet convexSet( aDigitalSet.domain() );
+   hull.digitizeInterior( convexSet );
+   @endcode
+   *
+   * @tparam TSpace a model of CSpace of dimension 3, like Z3i::Space.
+   * @tparam TInternalInteger a model of CInteger used for the exact
+   * computations (\c DGtal::int64_t by default).
+   */
+  template <typename TSpace, typename TInternalInteger = DGtal::int64_t>
+  class QuickHull3D
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace<TSpace> ));
+    BOOST_STATIC_ASSERT(( TSpace::dimension == 3 ));
+    BOOST_CONCEPT_ASSERT(( concepts::CInteger<TInternalInteger> ));
+
+    // ----------------------- Types ------------------------------------------
+  public:
+    typedef QuickHull3D<TSpace, TInternalInteger> Self;
+    typedef TSpace Space;
+    typedef typename Space::Point Point;
+    typedef typename Space::Integer Integer;
+    typedef TInternalInteger InternalInteger;
+    typedef IntegerComputer<InternalInteger> MyIntegerComputer;
+    /// Type of point or vector used for the internal computations
+    typedef typename MyIntegerComputer::Vector3I InternalVector;
+    /// Type of vertex index
+    typedef std::size_t Index;
+    /// Triangle, given by the indices of its vertices
+    typedef std::array<Index, 3> Triangle;
+
+    /**
+     * A facet of the convex hull, ie. the intersection of the convex
+     * hull with one of its supporting planes.
+     */
+    struct Facet
+    {
+      /// Irreducible outward normal
+      InternalVector normal;
+      /// Offset: the convex hull lies in @a normal . x <= @a offset
+      InternalInteger offset;
+      /// Indices of the vertices of the facet, counter-clockwise
+      /// ordered when seen from outside
+      std::vector<Index> vertices;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The convex hull is empty.
+     */
+    QuickHull3D();
+
+    /**
+     * Computes the convex hull of a range of points. Any previous
+     * result is cleared.
+     *
+     * @param itb begin iterator on the points
+     * @param ite end iterator on the points
+     * @return 'true' if the convex hull is a (full-dimensional)
+     * polytope, 'false' if the points are coplanar, in which case the
+     * convex hull is left empty.
+     *
+     * @tparam ConstIterator a model of forward and readable iterator on Point
+     */
+    template <typename ConstIterator>
+    bool compute( const ConstIterator& itb, const ConstIterator& ite );
+
+    /**
+     * Clears the convex hull.
+     */
+    void clear();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the vertices of the convex hull.
+     */
+    const std::vector<Point>& vertices() const;
+
+    /**
+     * @return the triangles of the boundary of the convex hull,
+     * counter-clockwise oriented when seen from outside.
+     */
+    const std::vector<Triangle>& triangles() const;
+
+    /**
+     * @return the facets of the convex hull.
+     */
+    const std::vector<Facet>& facets() const;
+
+    /**
+     * @return the number of vertices of the convex hull.
+     */
+    std::size_t nbVertices() const;
+
+    /**
+     * @return the number of facets of the convex hull.
+     */
+    std::size_t nbFacets() const;
+
+    /**
+     * @return the number of points given to the quickhull algorithm,
+     * ie. after the removal of the points lying in the middle of their rows.
+     */
+    std::size_t nbCandidatePoints() const;
+
+    /**
+     * @param p any point
+     * @return 'true' if @a p belongs to the (closed) convex hull,
+     * 'false' otherwise.
+     */
+    bool isInside( const Point& p ) const;
+
+    /**
+     * Inserts in @a aSet all the lattice points that belong to
+     * the convex hull and to the domain of @a aSet. The convex hull
+     * is scanned row by row, the extremities of each row being given
+     * by the facets inequalities.
+     *
+     * @param aSet (modified) any digital set, whose domain is a
+     * model of HyperRectDomain.
+     *
+     * @tparam TDigitalSet a model of CDigitalSet
+     */
+    template <typename TDigitalSet>
+    void digitizeInterior( TDigitalSet& aSet ) const;
+
+    /**
+     * @return the number of lattice points of the convex hull.
+     */
+    std::size_t nbLatticePoints() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /**
+     * A triangle of the current convex hull, together with its plane,
+     * its neighbors and the points lying above it.
+     */
+    struct Face
+    {
+      /// vertex indices (in myPoints)
+      Triangle v;
+      /// neighbor[i] is the face opposite to the edge (v[i], v[i+1])
+      std::array<Index, 3> neighbor;
+      /// normal (non reduced)
+      InternalVector normal;
+      /// offset
+      InternalInteger offset;
+      /// points lying strictly above the face
+      std::vector<Index> outside;
+      /// 'false' when the face has been removed
+      bool alive;
+      /// 'true' when the face has been found visible from the current apex
+      bool visible;
+    };
+
+    /// Candidate points
+    std::vector<InternalVector> myPoints;
+    /// Faces of the current convex hull
+    std::vector<Face> myFaces;
+    /// Vertices of the convex hull
+    std::vector<Point> myVertices;
+    /// Triangles of the convex hull
+    std::vector<Triangle> myTriangles;
+    /// Facets of the convex hull
+    std::vector<Facet> myFacets;
+    /// Lower and upper bounds of the vertices
+    InternalVector myLowerBound, myUpperBound;
+    /// Integer computer used for sequential computations
+    mutable MyIntegerComputer myIntegerComputer;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param u any vector
+     * @param v any vector
+     * @return the dot product of @a u and @a v
+     */
+    static InternalInteger dot( const InternalVector& u, const InternalVector& v );
+
+    /**
+     * @param f a face index
+     * @param p a point index
+     * @return the (signed, non normalized) height of the point @a p
+     * above the plane of the face @a f.
+     */
+    InternalInteger height( Index f, Index p ) const;
+
+    /**
+     * Creates a new face whose plane is computed from its vertices.
+     * @param a first vertex
+     * @param b second vertex
+     * @param c third vertex
+     * @return the index of the new face.
+     */
+    Index makeFace( Index a, Index b, Index c );
+
+    /**
+     * Gives each point of @a points to the first face of the range
+     * [ @a firstFace , myFaces.size() ) that sees it, if any.
+     * @param points point indices
+     * @param firstFace index of the first face to consider
+     */
+    void assignPoints( const std::vector<Index>& points, Index firstFace );
+
+    /**
+     * Adds the farthest point above the face @a f to the convex hull.
+     * @param f a face with a non-empty outside set
+     */
+    void addPoint( Index f );
+
+    /**
+     * Builds the initial tetrahedron.
+     * @return 'false' if the points are coplanar.
+     */
+    bool initialSimplex();
+
+    /**
+     * Builds myVertices, myTriangles and myFacets from the alive faces.
+     */
+    void extractResult();
+
+    /**
+     * Computes the extremities of the row of lattice points of the
+     * convex hull along the first axis, at given second and third coordinates.
+     * @param ic an integer computer
+     * @param y the second coordinate of the row
+     * @param z the third coordinate of the row
+     * @param xmin (returned) the first coordinate of the first point of the row
+     * @param xmax (returned) the first coordinate of the last point of the row
+     * @return 'false' if the row is empty.
+     */
+    bool rowInterval( MyIntegerComputer& ic,
+                      const InternalInteger& y, const InternalInteger& z,
+                      InternalInteger& xmin, InternalInteger& xmax ) const;
+
+    /**
+     * Converts an internal integer back to a coordinate.
+     * @param x any internal integer
+     * @return the corresponding coordinate.
+     */
+    static Integer toCoordinate( const InternalInteger& x );
+
+  }; // end of class QuickHull3D
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'QuickHull3D'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'QuickHull3D' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace, typename TInternalInteger>
+  std::ostream&
+  operator<< ( std::ostream & out, const QuickHull3D<TSpace, TInternalInteger> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/tools/QuickHull3D.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined QuickHull3D_h
+
+#undef QuickHull3D_RECURSES
+#endif // else defined(QuickHull3D_RECURSES)
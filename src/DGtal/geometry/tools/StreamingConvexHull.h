@@ -0,0 +1,232 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file StreamingConvexHull.h
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module StreamingConvexHull.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(StreamingConvexHull_RECURSES)
+#error Recursive header files inclusion detected in StreamingConvexHull.h
+#else // defined(StreamingConvexHull_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define StreamingConvexHull_RECURSES
+
+#if !defined StreamingConvexHull_h
+/** Prevents repeated inclusion of headers. */
+#define StreamingConvexHull_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/tools/determinant/COrientationFunctor2.h"
+#include "DGtal/geometry/tools/Hull2DHelpers.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class StreamingConvexHull
+  /**
+   * \brief Aim: This class maintains the convex hull of a set of 2D
+   * points that is given chunk by chunk, so that the whole set never
+   * has to be stored in memory (eg. points read slice by slice from a
+   * huge volume).
+   *
+   * Contrary to MelkmanConvexHull, no assumption is made on the order
+   * of the points. Each time a new chunk is added, the convex hull of
+   * the union of the current convex hull vertices and of the new points
+   * is computed by functions::Hull2D::parallelConvexHullAlgorithm
+   * (Akl-Toussaint filtering, then Andrew's algorithm on blocks,
+   * possibly in parallel). The memory requirement is thus proportional
+   * to the size of a chunk plus the size of the convex hull.
+   *
+   * The vertices are counter-clockwise oriented and collinear points
+   * are removed. The first vertex is the one that follows the lowest
+   * leftmost point.
+   *
+   * @code
+   typedef InHalfPlaneBySimple3x3Matrix<Z2i::Point, DGtal::int64_t> Functor;
+   StreamingConvexHull<Z2i::Point, Functor> hull;
+   for ( ... )
+     {
+       std::vector<Z2i::Point> chunk = ... //next chunk of points
+       hull.add( chunk.begin(), chunk.end() );
+     }
+   std::copy( hull.begin(), hull.end(), ... );
+   * @endcode
+   *
+   * @tparam TPoint a model of point
+   * @tparam TOrientationFunctor a model of COrientationFunctor2
+   * (whose inner type 'Point' match to 'TPoint')
+   */
+  template <typename TPoint,
+            typename TOrientationFunctor >
+  class StreamingConvexHull
+  {
+    // ----------------------- Types ------------------------------------------
+  public:
+    /**
+     * Self type
+     */
+    typedef StreamingConvexHull<TPoint, TOrientationFunctor> Self;
+    /**
+     * Type of point
+     */
+    typedef TPoint Point;
+    /**
+     * Type of orientation functor
+     */
+    typedef TOrientationFunctor Functor;
+    BOOST_CONCEPT_ASSERT(( concepts::COrientationFunctor2<Functor> ));
+    //the two types of points must be the same
+    BOOST_STATIC_ASSERT (( boost::is_same< Point, typename Functor::Point >::value ));
+    /**
+     * Type of iterator on the convex hull vertices
+     */
+    typedef typename std::vector<Point>::const_iterator ConstIterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param aFunctor an orientation functor, copied.
+     * @param aBlockSize minimal number of points of the blocks processed
+     * in parallel (see functions::Hull2D::parallelConvexHullAlgorithm).
+     */
+    StreamingConvexHull( const Functor& aFunctor = Functor(),
+                         std::size_t aBlockSize = 1 << 16 );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Considers a new chunk of points and updates the convex hull.
+     * @param itb begin iterator on the chunk
+     * @param ite end iterator on the chunk
+     *
+     * @tparam ForwardIterator a model of forward and readable iterator
+     */
+    template <typename ForwardIterator>
+    void add ( const ForwardIterator& itb, const ForwardIterator& ite );
+
+    /**
+     * Begin iterator
+     * @return a const iterator pointing to the first vertex
+     */
+    ConstIterator begin() const;
+
+    /**
+     * End iterator
+     * @return a const iterator pointing past-the-end
+     */
+    ConstIterator end() const;
+
+    /**
+     * @return the @a i-th vertex of the convex hull.
+     * @param i the index of the considered vertex.
+     */
+    const Point & operator[](unsigned int i) const;
+
+    /**
+     * @return the number of vertices of the convex hull.
+     **/
+    unsigned int size() const;
+
+    /**
+     * @return the number of points considered so far.
+     **/
+    std::size_t nbPoints() const;
+
+    /**
+     * Clears the current content of the convex hull.
+     **/
+    void clear();
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /**
+     * Vertices of the convex hull
+     */
+    std::vector<Point> myContainer;
+    /**
+     * Buffer used to store the current vertices together with a new chunk
+     */
+    std::vector<Point> myBuffer;
+    /**
+     * Orientation functor
+     */
+    Functor myFunctor;
+    /**
+     * Minimal number of points of a block
+     */
+    std::size_t myBlockSize;
+    /**
+     * Number of points considered so far
+     */
+    std::size_t myNbPoints;
+
+  }; // end of class StreamingConvexHull
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'StreamingConvexHull'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'StreamingConvexHull' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TPoint, typename TOrientationFunctor>
+  std::ostream&
+  operator<< ( std::ostream & out, const StreamingConvexHull<TPoint, TOrientationFunctor> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/tools/StreamingConvexHull.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined StreamingConvexHull_h
+
+#undef StreamingConvexHull_RECURSES
+#endif // else defined(StreamingConvexHull_RECURSES)
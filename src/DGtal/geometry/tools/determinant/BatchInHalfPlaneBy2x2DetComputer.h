@@ -0,0 +1,339 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BatchInHalfPlaneBy2x2DetComputer.h
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module BatchInHalfPlaneBy2x2DetComputer.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BatchInHalfPlaneBy2x2DetComputer_RECURSES)
+#error Recursive header files inclusion detected in BatchInHalfPlaneBy2x2DetComputer.h
+#else // defined(BatchInHalfPlaneBy2x2DetComputer_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BatchInHalfPlaneBy2x2DetComputer_RECURSES
+
+#if !defined BatchInHalfPlaneBy2x2DetComputer_h
+/** Prevents repeated inclusion of headers. */
+#define BatchInHalfPlaneBy2x2DetComputer_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <array>
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/NumberTraits.h"
+
+#include "DGtal/geometry/tools/determinant/C2x2DetComputer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BatchInHalfPlaneBy2x2DetComputer
+  /**
+   * \brief Aim: Class that implements an orientation functor, like
+   * InHalfPlaneBy2x2DetComputer, but that is designed to evaluate the
+   * orientation of many points at once, either with respect to one
+   * line or with respect to many lines.
+   *
+   * Points are processed by chunks of @a chunkSize. For each chunk,
+   * the determinants are first evaluated in double precision by a
+   * branch-free loop over contiguous arrays, that the compiler
+   * vectorizes (SSE2, AVX2 if the target allows it). Together with
+   * each determinant, a forward error bound is computed: its sign is
+   * returned as soon as its absolute value is greater than the bound
+   * (filtering step). The few remaining cases (points lying on or very
+   * close to the line) are given to the exact determinant computer
+   * @a TDetComputer.
+   *
+   * Since the error bound takes into account the rounding of the
+   * input coordinates, the returned signs are exact for any integral
+   * coordinates, provided that the differences of coordinates can be
+   * represented by @a ArgumentInteger, like for InHalfPlaneBy2x2DetComputer.
+   *
+   * Basic usage:
+   @code
+   typedef Z2i::Point Point;
+   typedef Simple2x2DetComputer<DGtal::int64_t, DGtal::int64_t> DeterminantComputer;
+   typedef BatchInHalfPlaneBy2x2DetComputer<Point, DeterminantComputer> MyType;
+
+   std::vector<Point> points = ...;
+   std::vector<MyType::Value> orientations;
+
+   MyType orientationTest;
+   orientationTest.init( Point(0,0), Point(5,2) );
+   orientationTest( points.begin(), points.end(), std::back_inserter( orientations ) );
+   @endcode
+   *
+   * @tparam TPoint a model of point
+   * @tparam TDetComputer a model of C2x2DetComputer, used when the
+   * filtering step fails.
+   *
+   * @note Unlike InHalfPlaneBy2x2DetComputer, only the sign of the
+   * determinant is returned, ie. -1, 0 or 1.
+   *
+   * @see InHalfPlaneBy2x2DetComputer Filtered2x2DetComputer
+   */
+  template <typename TPoint, typename TDetComputer>
+  class BatchInHalfPlaneBy2x2DetComputer
+  {
+    // ----------------------- Types  ------------------------------------
+  public:
+
+    /**
+     * Type of points
+     */
+    typedef TPoint Point;
+
+    /**
+     * Type of point array
+     */
+    typedef std::array<Point,2> PointArray;
+    /**
+     * Type used to represent the size of the array
+     */
+    typedef typename PointArray::size_type SizeArray;
+    /**
+     * static size of the array, ie. 2
+     */
+    static const SizeArray size = 2;
+
+    /**
+     * Type of the exact determinant computer
+     */
+    typedef TDetComputer DetComputer;
+    BOOST_CONCEPT_ASSERT(( C2x2DetComputer<DetComputer> ));
+
+    /**
+     * Type of input integers for the determinant computer
+     *
+     * NB: the type of the points coordinates are casted into ArgumentInteger
+     * before being passed to the determinant computer.
+     */
+    typedef typename TDetComputer::ArgumentInteger ArgumentInteger;
+
+    /**
+     * Type of integer for the result
+     */
+    typedef typename TDetComputer::ResultInteger Value;
+
+    /**
+     * Number of points processed at once in the filtering step
+     */
+    static const std::size_t chunkSize = 256;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default constructor.
+     */
+    BatchInHalfPlaneBy2x2DetComputer();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Initialisation.
+     * @param aP first point
+     * @param aQ second point
+     */
+    void init(const Point& aP, const Point& aQ);
+
+    /**
+     * Initialisation.
+     * @param aA array of two points
+     */
+    void init(const PointArray& aA);
+
+    /**
+     * Main operator.
+     * @warning BatchInHalfPlaneBy2x2DetComputer::init() should be called before
+     * @param aR any point to test
+     * @return orientation of the three points @a aP @a aQ @a aR :
+     * - zero if the three points belong to the same line
+     * - strictly positive if the three points are counter-clockwise oriented
+     * - striclty negative if the three points are clockwise oriented
+     */
+    Value operator()(const Point& aR) const;
+
+    /**
+     * Batch operator: orientation of each point of a range with respect
+     * to the line given at initialization.
+     * @warning BatchInHalfPlaneBy2x2DetComputer::init() should be called before
+     *
+     * @param itb begin iterator on the points to test
+     * @param ite end iterator on the points to test
+     * @param res output iterator on which the orientation of each point
+     * is written (in the same order)
+     * @return output iterator after the last written value.
+     *
+     * @tparam ForwardIterator a model of forward and readable iterator on points
+     * @tparam OutputIterator a model of incrementable and writable iterator on values
+     */
+    template <typename ForwardIterator, typename OutputIterator>
+    OutputIterator operator()(const ForwardIterator& itb, const ForwardIterator& ite,
+                              OutputIterator res) const;
+
+    /**
+     * Batch operator: orientation of many triples of points
+     * ( @a aP_i , @a aQ_i , @a aR_i ), each of them given by three
+     * parallel ranges. Contrary to the other operators,
+     * it does not depend on the line given at initialization.
+     *
+     * @param itP begin iterator on the first points
+     * @param iteP end iterator on the first points
+     * @param itQ begin iterator on the second points
+     * @param itR begin iterator on the points to test
+     * @param res output iterator on which the orientation of each triple
+     * is written (in the same order)
+     * @return output iterator after the last written value.
+     *
+     * @tparam ForwardIterator1 a model of forward and readable iterator on points
+     * @tparam ForwardIterator2 a model of forward and readable iterator on points
+     * @tparam ForwardIterator3 a model of forward and readable iterator on points
+     * @tparam OutputIterator a model of incrementable and writable iterator on values
+     */
+    template <typename ForwardIterator1, typename ForwardIterator2,
+              typename ForwardIterator3, typename OutputIterator>
+    OutputIterator operator()(const ForwardIterator1& itP, const ForwardIterator1& iteP,
+                              const ForwardIterator2& itQ, const ForwardIterator3& itR,
+                              OutputIterator res) const;
+
+    /**
+     * @return the number of orientations that have been given to the
+     * exact determinant computer since the last call to init()
+     * (ie. for which the filtering step failed).
+     */
+    std::size_t nbExactEvaluations() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Evaluates @a n determinants \f$ a_i y_i - b_i x_i \f$ in double
+     * precision, together with a bound on the absolute error.
+     * The loop has no branch, so that it may be vectorized.
+     *
+     * @param a 0-components of the first column vectors
+     * @param b 1-components of the first column vectors
+     * @param x 0-components of the second column vectors
+     * @param y 1-components of the second column vectors
+     * @param n number of determinants
+     * @param det (returned) approximated determinants
+     * @param err (returned) error bounds
+     */
+    static void filter( const double* a, const double* b,
+                        const double* x, const double* y,
+                        std::size_t n, double* det, double* err );
+
+    /**
+     * Same as above, but with a constant first column vector ( @a a , @a b ).
+     *
+     * @param a 0-component of the first column vector
+     * @param b 1-component of the first column vector
+     * @param x 0-components of the second column vectors
+     * @param y 1-components of the second column vectors
+     * @param n number of determinants
+     * @param det (returned) approximated determinants
+     * @param err (returned) error bounds
+     */
+    static void filter( double a, double b,
+                        const double* x, const double* y,
+                        std::size_t n, double* det, double* err );
+
+    /**
+     * Evaluates the determinants of a chunk of points with
+     * respect to the line given at initialization.
+     *
+     * @param itb begin iterator on the chunk
+     * @param n number of points in the chunk
+     * @param res output iterator
+     * @return output iterator after the last written value.
+     */
+    template <typename ForwardIterator, typename OutputIterator>
+    OutputIterator processChunk(ForwardIterator itb, std::size_t n,
+                                OutputIterator res) const;
+
+    /**
+     * Coordinates of the first point.
+     */
+    ArgumentInteger myA, myB;
+    /**
+     * Coordinates of the direction vector.
+     */
+    ArgumentInteger myU, myV;
+    /**
+     * Coordinates of the direction vector, as doubles.
+     */
+    double myUd, myVd;
+    /**
+     * A 2x2 determinant computer used when the filtering step fails.
+     */
+    mutable DetComputer myDetComputer;
+    /**
+     * Number of exact evaluations since the last initialisation.
+     */
+    mutable std::size_t myNbExact;
+
+  }; // end of class BatchInHalfPlaneBy2x2DetComputer
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BatchInHalfPlaneBy2x2DetComputer'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BatchInHalfPlaneBy2x2DetComputer' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TPoint, typename TDetComputer>
+  std::ostream&
+  operator<< ( std::ostream & out, const BatchInHalfPlaneBy2x2DetComputer<TPoint, TDetComputer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/tools/determinant/BatchInHalfPlaneBy2x2DetComputer.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BatchInHalfPlaneBy2x2DetComputer_h
+
+#undef BatchInHalfPlaneBy2x2DetComputer_RECURSES
+#endif // else defined(BatchInHalfPlaneBy2x2DetComputer_RECURSES)
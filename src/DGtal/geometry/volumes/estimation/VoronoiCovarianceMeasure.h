@@ -42,6 +42,9 @@
 // Inclusions
 #include <cmath>
 #include <iostream>
+#include <vector>
+#include <map>
+#include <mutex>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/BasicMathFunctions.h"
 #include "DGtal/kernel/BasicPointPredicates.h"
@@ -50,7 +53,7 @@
 #include "DGtal/kernel/Point2ScalarFunctors.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/geometry/volumes/distance/VoronoiMap.h"
-#include "DGtal/geometry/tools/SpatialCubicalSubdivision.h"
+#include "DGtal/geometry/tools/CompactSpatialCubicalSubdivision.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -65,7 +68,15 @@ namespace DGtal
    * arbitrary function with given support.
    *
    * You may obtain the whole sequence (Point,VCM) by accessing the
-   * map \ref vcmMap.
+   * map \ref vcmMap, or more efficiently by the array \ref vcmArray,
+   * whose i-th matrix is the VCM of the i-th site of \ref sites.
+   *
+   * The covariance matrices are stored in a contiguous array indexed
+   * by site. Only the rows of the domain that intersect the R-offset
+   * are visited and, if DGtal has been built with OpenMP support
+   * (WITH_OPENMP flag set to "true"), they are visited in parallel.
+   * The matrices of the sites are then shared between threads, each
+   * site being protected by one of \ref NbLocks locks.
    *
    * @note Documentation in \ref moduleVCM_sec2.
    *
@@ -89,7 +100,7 @@ namespace DGtal
     typedef typename Space::Integer Integer;      ///< the type of each digital point coordinate, some integral type
     typedef DGtal::HyperRectDomain<Space> Domain; ///< the type of rectangular domain of the VCM.
     typedef DGtal::ImageContainerBySTLVector<Domain,bool> CharacteristicSet; ///< the type of a binary image that is the characteristic function of K.
-    typedef DGtal::SpatialCubicalSubdivision<Space> ProximityStructure; ///< the structure used for proximity queries.
+    typedef DGtal::CompactSpatialCubicalSubdivision<Space> ProximityStructure; ///< the structure used for proximity queries.
 
     /**
        A predicate that returns 'true' whenever the given binary image contains 'true'.
@@ -121,6 +132,7 @@ namespace DGtal
     typedef typename MatrixNN::RowVector VectorN;             ///< the type for N-vector of real numbers
     typedef std::vector<Point> PointContainer;                ///< the list of points
     typedef std::map<Point,MatrixNN> Point2MatrixNN;          ///< Associates a matrix to points.
+    typedef std::vector<MatrixNN> MatrixNNContainer;          ///< the list of matrices, indexed by site.
 
     // ----------------------- Standard services ------------------------------
   public:
@@ -182,8 +194,27 @@ namespace DGtal
     /// @return the Voronoi Covariance Matrix of each Voronoi cell as
     /// a map Point -> Matrix
     /// @note empty if \ref init has not been called.
+    /// @note the map is built by \ref init, so that this method may
+    /// be called concurrently.
     const Point2MatrixNN& vcmMap() const;
 
+    /// @return the sites, i.e. the points of K, in increasing order
+    /// and without duplicates.
+    /// @note empty if \ref init has not been called.
+    const PointContainer& sites() const;
+
+    /// @return the Voronoi Covariance Matrix of each Voronoi cell as
+    /// an array, whose i-th element is the matrix of the i-th site.
+    /// @note empty if \ref init has not been called.
+    const MatrixNNContainer& vcmArray() const;
+
+    /**
+       @param p any point.
+       @return the index of \a p in \ref sites, or the number of sites
+       if \a p is not a site.
+    */
+    Size siteIndex( const Point& p ) const;
+
     /**
     Computes the Voronoi Covariance Measure of the function \a chi_r.
     
@@ -200,6 +231,26 @@ namespace DGtal
     template <typename Point2ScalarFunction>
     MatrixNN measure( Point2ScalarFunction chi_r, Point p ) const;
 
+    /**
+    Computes the Voronoi Covariance Measure of the function \a chi_r
+    moved at each point of \a points. The measures are computed in
+    parallel if DGtal has been built with OpenMP support.
+
+    @tparam Point2ScalarFunction the type of a functor
+    Point->Scalar, whose evaluation is thread-safe.
+
+    @param chi_r the kernel function whose support is included in
+    the cube centered on the origin with edge size 2r.
+
+    @param points the points where the kernel function is moved.
+    They must lie within domain.
+
+    @param[out] result the measures, result[i] being the measure at points[i].
+    */
+    template <typename Point2ScalarFunction>
+    void measure( Point2ScalarFunction chi_r, const PointContainer& points,
+                  MatrixNNContainer& result ) const;
+
     // ----------------------- Interface --------------------------------------
   public:
 
@@ -235,7 +286,11 @@ namespace DGtal
     CharacteristicSet* myCharSet;
     /// Stores the voronoi map.
     Voronoi* myVoronoi;
-    /// The map point -> VCM
+    /// The sites, i.e. the points of K, sorted.
+    PointContainer mySites;
+    /// The VCM of each site.
+    MatrixNNContainer myVCMs;
+    /// The map point -> VCM.
     Point2MatrixNN myVCM;
     /// The structure used for proximity queries.
     ProximityStructure* myProximityStructure;
@@ -269,6 +324,53 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /// An interval [first,second] of abscissas in a row.
+    typedef std::pair<Integer, Integer> Interval;
+
+    /// The number of locks protecting the matrices of the sites
+    /// while they are accumulated, site i using lock i % NbLocks.
+    static const Size NbLocks = 256;
+
+    /**
+       Adds a matrix to the VCM of a site, under the lock of this site.
+
+       @param index the index of a site, or the number of sites (then
+       nothing is done).
+       @param m the matrix to add.
+       @param locks the locks of the sites.
+    */
+    void addToSite( Size index, const MatrixNN& m,
+                    std::vector<std::mutex>& locks );
+
+    /**
+       Computes, for each row of the domain along the first axis, the
+       sorted disjoint intervals of abscissas that may intersect the
+       R-offset of the sites, i.e. the dilation of the sites by the
+       cube of radius intR. A row is given by the point of the row
+       with smallest abscissa. The offset of a closed surface thus
+       gives two intervals in the rows that cross its interior.
+
+       @param[out] rowBegin the intervals of row r are at indices
+       rowBegin[r] to rowBegin[r+1]-1 (one more value than rows).
+       @param[out] intervals the intervals of all the rows.
+       @param intR the (integer) offset radius.
+    */
+    void computeOffsetRows( std::vector<Size>& rowBegin,
+                            std::vector<Interval>& intervals,
+                            Integer intR ) const;
+
+    /**
+       @param r the index of a row of the domain along the first axis.
+       @return the point of the row with smallest abscissa.
+    */
+    Point rowPoint( Size r ) const;
+
+    /**
+       @param p any point of the domain.
+       @return the index of the row of \a p along the first axis.
+    */
+    Size rowIndex( const Point& p ) const;
+
   }; // end of class VoronoiCovarianceMeasure
 
 
@@ -0,0 +1,200 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BucketQueue.h
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module BucketQueue.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BucketQueue_RECURSES)
+#error Recursive header files inclusion detected in BucketQueue.h
+#else // defined(BucketQueue_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BucketQueue_RECURSES
+
+#if !defined BucketQueue_h
+/** Prevents repeated inclusion of headers. */
+#define BucketQueue_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <boost/type_traits/is_integral.hpp>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BucketQueue
+  /**
+     Description of template class 'BucketQueue' <p> \brief Aim: A
+     priority queue of pairs whose priority is an integer (the second
+     member of the pair), the smallest value being the top of the
+     queue. Pairs are stored in one bucket per value (Dial's
+     algorithm), hence push and pop are O(1) operations, top() and
+     pop() amortizing the scanning of empty buckets as long as the
+     pushed values do not decrease much.
+
+     It has the same interface as std::priority_queue and may thus
+     replace it in DistanceBreadthFirstVisitor (see BucketNodeQueue)
+     for integer-valued metrics (e.g. squared Euclidean distances,
+     chamfer or L1 norms), real-valued metrics being quantized
+     beforehand. The memory used is linear in the range of values,
+     pairs with the same value being popped in any order.
+
+     @tparam TNode the type of the stored pairs, whose second member
+     is an integer.
+   */
+  template <typename TNode>
+  class BucketQueue
+  {
+  public:
+    typedef TNode Node;
+    typedef TNode value_type;
+    typedef typename Node::second_type Key;
+    typedef std::size_t size_type;
+    BOOST_STATIC_ASSERT(( boost::is_integral<Key>::value ));
+
+    /// Constructor. The queue is empty.
+    BucketQueue()
+      : myBuckets(), myBase( 0 ), myCurrent( 0 ), mySize( 0 ) {}
+
+    /// @return 'true' if the queue is empty.
+    bool empty() const
+    { return mySize == 0; }
+
+    /// @return the number of pairs in the queue.
+    size_type size() const
+    { return mySize; }
+
+    /**
+       @return a pair with the smallest value.
+       NB: valid only if not 'empty()'.
+    */
+    const Node & top() const
+    {
+      ASSERT( ! empty() );
+      return myBuckets[ myCurrent ].back();
+    }
+
+    /**
+       Inserts a pair.
+       @param node any pair.
+    */
+    void push( const Node & node )
+    {
+      if ( mySize == 0 )
+        {
+          myBase = node.second;
+          myCurrent = 0;
+        }
+      else if ( node.second < myBase )
+        { // Rare case: buckets are added in front.
+          size_type shift = (size_type) ( myBase - node.second );
+          myBuckets.insert( myBuckets.begin(), shift, Bucket() );
+          myCurrent += shift;
+          myBase = node.second;
+        }
+      size_type k = (size_type) ( node.second - myBase );
+      if ( k >= myBuckets.size() ) myBuckets.resize( k + 1 );
+      myBuckets[ k ].push_back( node );
+      if ( k < myCurrent ) myCurrent = k;
+      ++mySize;
+    }
+
+    /**
+       Removes the top pair.
+       NB: valid only if not 'empty()'.
+    */
+    void pop()
+    {
+      ASSERT( ! empty() );
+      myBuckets[ myCurrent ].pop_back();
+      if ( --mySize != 0 )
+        while ( myBuckets[ myCurrent ].empty() ) ++myCurrent;
+    }
+
+    /**
+       Exchange 'this' object with 'other'.
+       @param other the other instance.
+    */
+    void swap( BucketQueue & other )
+    {
+      myBuckets.swap( other.myBuckets );
+      std::swap( myBase, other.myBase );
+      std::swap( myCurrent, other.myCurrent );
+      std::swap( mySize, other.mySize );
+    }
+
+  private:
+    typedef std::vector<Node> Bucket;
+    /// The buckets, the i-th one storing the pairs of value myBase + i.
+    std::vector<Bucket> myBuckets;
+    /// The value of the first bucket.
+    Key myBase;
+    /// The index of the first non empty bucket (if not empty).
+    size_type myCurrent;
+    /// The number of pairs in the queue.
+    size_type mySize;
+  };
+
+  /**
+     Selects std::priority_queue as the queue of nodes of
+     DistanceBreadthFirstVisitor (the default), for any metric.
+  */
+  struct HeapNodeQueue
+  {
+    template <typename TNode>
+    struct Queue
+    {
+      typedef std::priority_queue<TNode> Type;
+    };
+  };
+
+  /**
+     Selects BucketQueue as the queue of nodes of
+     DistanceBreadthFirstVisitor, for integer-valued metrics.
+  */
+  struct BucketNodeQueue
+  {
+    template <typename TNode>
+    struct Queue
+    {
+      typedef BucketQueue<TNode> Type;
+    };
+  };
+
+} // namespace DGtal
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BucketQueue_h
+
+#undef BucketQueue_RECURSES
+#endif // else defined(BucketQueue_RECURSES)
@@ -44,8 +44,11 @@
 #include <queue>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/Alias.h"
 #include "DGtal/base/CountedPtr.h"
+#include "DGtal/base/CountedPtrOrPtr.h"
 #include "DGtal/graph/CUndirectedSimpleLocalGraph.h"
+#include "DGtal/graph/BucketQueue.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -89,7 +92,17 @@ namespace DGtal
   neighbors.
 
   @tparam TMarkSet the type that is used to store marked
-  vertices. Should be a set of Vertex, hence a model of CSet.
+  vertices. Should be a set of Vertex, hence a model of CSet. When
+  vertices can be numbered (e.g. FrozenDigitalSurface), an
+  IndexedVertexSet, given by reference to the constructor, has O(1)
+  operations.
+
+  @tparam TNodeQueueSelector selects the priority queue of nodes:
+  HeapNodeQueue (default) uses a binary heap (std::priority_queue)
+  and works for any metric, BucketNodeQueue uses a BucketQueue (Dial's
+  algorithm) with O(1) push and pop operations, for vertex functors
+  returning integers (e.g. squared Euclidean distances, chamfer or L1
+  norms, or real-valued distances quantized beforehand).
  
   @code
      #include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
@@ -196,17 +209,42 @@ while ( ! visitor.finished() )
     }
    @endcode
 
+   Growing many balls with an integer metric (e.g. around every
+   surfel of a FrozenDigitalSurface) is much faster with the bucket
+   queue and an indexed set of marked vertices. The mark set, sized
+   to the graph, is allocated once and aliased by the successive
+   visitors. Once a visitor is finished or terminated, its marked
+   vertices are its visited vertices, and IndexedVertexSet::clear
+   only resets them, so that each ball costs its size and not the
+   size of the graph:
+
+   @code
+typedef IndexedVertexSet<Graph::Vertex, functors::Identity> MarkSet;
+typedef DistanceBreadthFirstVisitor< Graph, SquaredDistanceToSurfel, MarkSet,
+                                     BucketNodeQueue > Visitor;
+MarkSet marks( functors::Identity(), g.size() );
+for ( Graph::Vertex v = 0; v < g.size(); ++v )
+  {
+    Visitor visitor( g, SquaredDistanceToSurfel( g, v ), v, marks );
+    while ( ! visitor.finished() && visitor.current().second <= r2 )
+      { ... visitor.expand(); }
+    visitor.terminate();
+    marks.clear();
+  }
+   @endcode
+
    @see testDistancePropagation.cpp
    @see testObject.cpp
    */
   template < typename TGraph, 
              typename TVertexFunctor,
-             typename TMarkSet = typename TGraph::VertexSet >
+             typename TMarkSet = typename TGraph::VertexSet,
+             typename TNodeQueueSelector = HeapNodeQueue >
   class DistanceBreadthFirstVisitor
   {
     // ----------------------- Associated types ------------------------------
   public:
-    typedef DistanceBreadthFirstVisitor<TGraph,TVertexFunctor,TMarkSet> Self;
+    typedef DistanceBreadthFirstVisitor<TGraph,TVertexFunctor,TMarkSet,TNodeQueueSelector> Self;
     typedef TGraph Graph;
     typedef TVertexFunctor VertexFunctor;
     typedef TMarkSet MarkSet;
@@ -260,7 +298,7 @@ while ( ! visitor.finished() )
     };
 
     /// Internal data structure for computing the distance ordering expansion.
-    typedef std::priority_queue< Node > NodeQueue;
+    typedef typename TNodeQueueSelector::template Queue< Node >::Type NodeQueue;
     /// Internal data structure for storing vertices.
     typedef std::vector< Vertex > VertexList;
 
@@ -309,6 +347,43 @@ while ( ! visitor.finished() )
                      const VertexFunctor & distance,
                      VertexIterator b, VertexIterator e );
 
+    /**
+     * Constructor from a point, a vertex functor object and a set of
+     * marked vertices. This point provides the initial core of the
+     * visitor.
+     *
+     * @param graph the graph in which the distance ordering traversal takes place (aliased).
+     * @param distance the distance object, a functor Vertex -> Scalar (cloned).
+     * @param p any vertex of the graph.
+     * @param markSet the set storing marked vertices (aliased),
+     * generally empty (e.g. an IndexedVertexSet sized to the graph,
+     * reused by successive visitors).
+     */
+    DistanceBreadthFirstVisitor( ConstAlias<Graph> graph, 
+                     const VertexFunctor & distance,
+                     const Vertex & p,
+                     Alias<MarkSet> markSet );
+
+    /**
+       Constructor from a graph, a vertex functor, two iterators
+       specifying a range and a set of marked vertices. All vertices
+       visited between the iterators should be distinct two by
+       two. The so specified set of vertices provides the initial core
+       of the distance ordering traversal.
+       
+       @tparam VertexIterator any type of single pass iterator on vertices.
+       @param graph the graph in which the distance ordering traversal takes place (aliased).
+       @param distance the distance object, a functor Vertex -> Scalar (cloned).
+       @param b the begin iterator in a container of vertices. 
+       @param e the end iterator in a container of vertices. 
+       @param markSet the set storing marked vertices (aliased), generally empty.
+    */
+    template <typename VertexIterator>
+    DistanceBreadthFirstVisitor( const Graph & graph, 
+                     const VertexFunctor & distance,
+                     VertexIterator b, VertexIterator e,
+                     Alias<MarkSet> markSet );
+
 
     /**
        @return a const reference on the graph that is traversed.
@@ -490,9 +565,10 @@ while ( ! visitor.finished() )
     /**
      * Set representing the marked vertices: the ones that have been
      * visited and the ones that are going to be visited soon (at
-     * closest distance).
+     * closest distance). Owned by the visitor, or aliased when given
+     * to the constructor.
      */
-    MarkSet myMarkedVertices;
+    CountedPtrOrPtr<MarkSet> myMarkedVertices;
 
     /**
        Queue storing the vertices that are the next visited ones in
@@ -531,10 +607,11 @@ while ( ! visitor.finished() )
    * @param object the object of class 'DistanceBreadthFirstVisitor' to write.
    * @return the output stream after the writing.
    */
-  template < typename TGraph, typename TVertexFunctor, typename TMarkSet >
+  template < typename TGraph, typename TVertexFunctor, typename TMarkSet,
+           typename TNodeQueueSelector >
   std::ostream&
   operator<< ( std::ostream & out, 
-               const DistanceBreadthFirstVisitor<TGraph,TVertexFunctor,TMarkSet> & object );
+               const DistanceBreadthFirstVisitor<TGraph,TVertexFunctor,TMarkSet,TNodeQueueSelector> & object );
 
 } // namespace DGtal
 
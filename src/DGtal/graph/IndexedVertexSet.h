@@ -0,0 +1,210 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file IndexedVertexSet.h
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module IndexedVertexSet.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(IndexedVertexSet_RECURSES)
+#error Recursive header files inclusion detected in IndexedVertexSet.h
+#else // defined(IndexedVertexSet_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define IndexedVertexSet_RECURSES
+
+#if !defined IndexedVertexSet_h
+/** Prevents repeated inclusion of headers. */
+#define IndexedVertexSet_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <limits>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class IndexedVertexSet
+  /**
+     Description of template class 'IndexedVertexSet' <p> \brief Aim:
+     A set of vertices of a graph whose vertices are numbered from 0
+     to some \a size, with O(1) find, insert and erase
+     operations. It may be used as the set of marked vertices of
+     graph visitors (e.g. DistanceBreadthFirstVisitor or
+     BreadthFirstVisitor) instead of a tree or a hash table.
+
+     The set stores the position of each vertex in a contiguous array
+     of the inserted vertices, hence it uses O(\a size) memory. The
+     vertices are enumerated in insertion order, as long as no vertex
+     is erased.
+
+     @tparam TVertex the type of vertex.
+     @tparam TVertexIndex the type of a functor Vertex -> std::size_t
+     giving the index of each vertex (e.g. functors::Identity when
+     vertices are already indices, as in FrozenDigitalSurface).
+   */
+  template <typename TVertex, typename TVertexIndex>
+  class IndexedVertexSet
+  {
+  public:
+    typedef TVertex Vertex;
+    typedef TVertexIndex VertexIndex;
+    typedef Vertex value_type;
+    typedef Vertex key_type;
+    typedef std::size_t size_type;
+    typedef typename std::vector<Vertex>::const_iterator const_iterator;
+    typedef const_iterator iterator;
+
+    /**
+       Constructor. The set is empty.
+       @param index the functor giving the index of each vertex.
+       @param size the number of indices (all indices are lower than \a size).
+    */
+    IndexedVertexSet( const VertexIndex & index = VertexIndex(),
+                      size_type size = 0 )
+      : myIndex( index ), myPositions( size, npos() ) {}
+
+    /// @return the number of vertices in the set.
+    size_type size() const
+    { return myVertices.size(); }
+
+    /// @return 'true' if the set is empty.
+    bool empty() const
+    { return myVertices.empty(); }
+
+    /// @return an iterator on the first vertex of the set.
+    const_iterator begin() const
+    { return myVertices.begin(); }
+
+    /// @return an iterator after the last vertex of the set.
+    const_iterator end() const
+    { return myVertices.end(); }
+
+    /**
+       @param v any vertex.
+       @return an iterator on \a v if it is in the set, end() otherwise.
+    */
+    const_iterator find( const Vertex & v ) const
+    {
+      size_type pos = myPositions[ myIndex( v ) ];
+      return pos == npos() ? end() : begin() + pos;
+    }
+
+    /**
+       @param v any vertex.
+       @return 1 if \a v is in the set, 0 otherwise.
+    */
+    size_type count( const Vertex & v ) const
+    { return myPositions[ myIndex( v ) ] == npos() ? 0 : 1; }
+
+    /**
+       Inserts a vertex.
+       @param v any vertex.
+       @return an iterator on \a v and 'true' if it was not in the set.
+    */
+    std::pair<const_iterator, bool> insert( const Vertex & v )
+    {
+      size_type & pos = myPositions[ myIndex( v ) ];
+      if ( pos != npos() )
+        return std::make_pair( begin() + pos, false );
+      pos = myVertices.size();
+      myVertices.push_back( v );
+      return std::make_pair( begin() + pos, true );
+    }
+
+    /**
+       Removes a vertex of the set. The last vertex takes its place.
+       @param it any valid iterator on a vertex of the set.
+    */
+    void erase( const_iterator it )
+    {
+      size_type pos = it - begin();
+      myPositions[ myIndex( *it ) ] = npos();
+      if ( pos + 1 != myVertices.size() )
+        {
+          myVertices[ pos ] = myVertices.back();
+          myPositions[ myIndex( myVertices[ pos ] ) ] = pos;
+        }
+      myVertices.pop_back();
+    }
+
+    /**
+       Removes a vertex, if it is in the set.
+       @param v any vertex.
+       @return the number of removed vertices (0 or 1).
+    */
+    size_type erase( const Vertex & v )
+    {
+      const_iterator it = find( v );
+      if ( it == end() ) return 0;
+      erase( it );
+      return 1;
+    }
+
+    /// Removes all the vertices, in time linear in the size of the set.
+    void clear()
+    {
+      for ( const_iterator it = begin(), itE = end(); it != itE; ++it )
+        myPositions[ myIndex( *it ) ] = npos();
+      myVertices.clear();
+    }
+
+    /**
+       Exchange 'this' object with 'other'.
+       @param other the other instance.
+    */
+    void swap( IndexedVertexSet & other )
+    {
+      std::swap( myIndex, other.myIndex );
+      myPositions.swap( other.myPositions );
+      myVertices.swap( other.myVertices );
+    }
+
+  private:
+    /// The index of each vertex.
+    VertexIndex myIndex;
+    /// The position of each vertex in myVertices, or npos().
+    std::vector<size_type> myPositions;
+    /// The vertices of the set.
+    std::vector<Vertex> myVertices;
+
+    /// @return the position of the vertices that are not in the set.
+    static size_type npos()
+    { return std::numeric_limits<size_type>::max(); }
+  };
+
+} // namespace DGtal
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined IndexedVertexSet_h
+
+#undef IndexedVertexSet_RECURSES
+#endif // else defined(IndexedVertexSet_RECURSES)
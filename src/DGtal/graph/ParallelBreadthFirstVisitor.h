@@ -0,0 +1,412 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ParallelBreadthFirstVisitor.h
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module ParallelBreadthFirstVisitor.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ParallelBreadthFirstVisitor_RECURSES)
+#error Recursive header files inclusion detected in ParallelBreadthFirstVisitor.h
+#else // defined(ParallelBreadthFirstVisitor_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ParallelBreadthFirstVisitor_RECURSES
+
+#if !defined ParallelBreadthFirstVisitor_h
+/** Prevents repeated inclusion of headers. */
+#define ParallelBreadthFirstVisitor_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <atomic>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/BasicPointPredicates.h"
+#include "DGtal/graph/CUndirectedSimpleLocalGraph.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class VertexSetMarker
+  /**
+     Description of template class 'VertexSetMarker' <p> \brief
+     Aim: Stores the vertices marked by a ParallelBreadthFirstVisitor
+     in a set of vertices (e.g. the VertexSet of the graph). Marking
+     is not thread-safe: the visitor marks the vertices of each new
+     layer sequentially.
+
+     @tparam TVertex the type of vertex.
+     @tparam TMarkSet the type of set of vertices (with find, end and insert methods).
+   */
+  template <typename TVertex, typename TMarkSet>
+  class VertexSetMarker
+  {
+  public:
+    typedef TVertex Vertex;
+    typedef TMarkSet MarkSet;
+    /// Marking is not thread-safe.
+    BOOST_STATIC_CONSTANT( bool, isConcurrent = false );
+
+    /**
+       Constructor.
+       @param markSet the initial set of marked vertices (generally empty).
+    */
+    VertexSetMarker( const MarkSet & markSet = MarkSet() )
+      : myMarkSet( markSet ) {}
+
+    /**
+       @param v any vertex.
+       @return 'true' if \a v is marked.
+    */
+    bool isMarked( const Vertex & v ) const
+    { return myMarkSet.find( v ) != myMarkSet.end(); }
+
+    /**
+       Marks a vertex.
+       @param v any vertex.
+       @return 'true' if \a v was not marked before.
+    */
+    bool mark( const Vertex & v )
+    {
+      if ( isMarked( v ) ) return false;
+      myMarkSet.insert( v );
+      return true;
+    }
+
+    /// @return the set of marked vertices.
+    const MarkSet & markSet() const
+    { return myMarkSet; }
+
+  private:
+    /// The marked vertices.
+    MarkSet myMarkSet;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class IndexedVertexMarker
+  /**
+     Description of template class 'IndexedVertexMarker' <p> \brief
+     Aim: Stores the vertices marked by a ParallelBreadthFirstVisitor
+     in a bitmap, when the vertices of the graph can be numbered from
+     0 to some \a size. Marking is thread-safe, hence the threads
+     expanding a layer mark the vertices directly.
+
+     @tparam TVertex the type of vertex.
+     @tparam TVertexIndex the type of a functor Vertex -> std::size_t
+     giving the index of each vertex.
+   */
+  template <typename TVertex, typename TVertexIndex>
+  class IndexedVertexMarker
+  {
+  public:
+    typedef TVertex Vertex;
+    typedef TVertexIndex VertexIndex;
+    /// Marking is thread-safe.
+    BOOST_STATIC_CONSTANT( bool, isConcurrent = true );
+
+    /**
+       Constructor. No vertex is marked.
+       @param index the functor giving the index of each vertex.
+       @param size the number of indices (all indices are lower than \a size).
+    */
+    IndexedVertexMarker( const VertexIndex & index, std::size_t size )
+      : myIndex( index ), myFlags( size )
+    {
+      for ( std::size_t i = 0; i < size; ++i ) myFlags[ i ].store( 0 );
+    }
+
+    /**
+       Copy constructor.
+       @param other the object to clone.
+    */
+    IndexedVertexMarker( const IndexedVertexMarker & other )
+      : myIndex( other.myIndex ), myFlags( other.myFlags.size() )
+    {
+      for ( std::size_t i = 0; i < myFlags.size(); ++i )
+        myFlags[ i ].store( other.myFlags[ i ].load() );
+    }
+
+    /**
+       @param v any vertex.
+       @return 'true' if \a v is marked.
+    */
+    bool isMarked( const Vertex & v ) const
+    { return myFlags[ myIndex( v ) ].load( std::memory_order_relaxed ) != 0; }
+
+    /**
+       Marks a vertex. Thread-safe.
+       @param v any vertex.
+       @return 'true' if \a v was not marked before (only one thread
+       gets 'true' for a given vertex).
+    */
+    bool mark( const Vertex & v )
+    { return myFlags[ myIndex( v ) ].exchange( 1 ) == 0; }
+
+  private:
+    /// The index of each vertex.
+    VertexIndex myIndex;
+    /// The flags of the vertices.
+    std::vector< std::atomic<unsigned char> > myFlags;
+
+    /// Assignment is forbidden.
+    IndexedVertexMarker & operator=( const IndexedVertexMarker & other );
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ParallelBreadthFirstVisitor
+  /**
+     Description of template class 'ParallelBreadthFirstVisitor' <p> \brief
+     Aim: This class performs a level-synchronous breadth-first
+     exploration of a graph given a starting point or set (called
+     initial core), each layer being expanded in parallel.
+
+     Like Expander, the visitor moves layer by layer: layer() is the
+     set of vertices at distance() of the initial core. The next
+     layer is computed by nextLayer(): the vertices of the current
+     layer are shared among the threads (if DGtal has been built with
+     OpenMP support, WITH_OPENMP flag set to "true"), each thread
+     collecting the unmarked neighbors into its own next layer. The
+     local layers are then gathered and sorted, so that each layer
+     does not depend on the number of threads.
+
+     Marked vertices are stored by a marker: a VertexSetMarker (the
+     default, using the VertexSet of the graph) is only read by the
+     threads and updated after each layer, while an
+     IndexedVertexMarker (a bitmap, when the graph provides an index
+     of its vertices) is updated concurrently, which avoids
+     duplicates in the local layers.
+
+     @tparam TGraph the type of the graph (models of
+     CUndirectedSimpleLocalGraph), whose method writeNeighbors must be
+     thread-safe (e.g. Object or FrozenDigitalSurface, but not
+     DigitalSurface, whose tracker is shared). Its vertices must be
+     comparable with operator<.
+
+     @tparam TMarker the type of the structure storing marked
+     vertices (VertexSetMarker or IndexedVertexMarker).
+
+     @code
+     typedef FrozenDigitalSurface<Container> Graph;
+     typedef IndexedVertexMarker<Graph::Vertex, functors::Identity> Marker;
+     Graph graph( surface );
+     ParallelBreadthFirstVisitor< Graph, Marker >
+       visitor( graph, 0, Marker( functors::Identity(), graph.size() ) );
+     do
+       {
+         std::cout << "Layer " << visitor.distance() << " :"
+                   << visitor.layer().size() << " vertices." << std::endl;
+       }
+     while ( visitor.nextLayer() );
+     @endcode
+
+     @see BreadthFirstVisitor
+     @see Expander
+   */
+  template < typename TGraph,
+             typename TMarker = VertexSetMarker< typename TGraph::Vertex,
+                                                 typename TGraph::VertexSet > >
+  class ParallelBreadthFirstVisitor
+  {
+    // ----------------------- Associated types ------------------------------
+  public:
+    typedef ParallelBreadthFirstVisitor<TGraph,TMarker> Self;
+    typedef TGraph Graph;
+    typedef TMarker Marker;
+    typedef typename Graph::Size Size;
+    typedef typename Graph::Vertex Vertex;
+    /// Internal data structure for storing vertices.
+    typedef std::vector< Vertex > VertexList;
+    /// Iterator on the vertices of the current layer.
+    typedef typename VertexList::const_iterator ConstIterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Constructor from a point. This point provides the initial core
+       of the visitor.
+
+       @param graph the graph in which the breadth first traversal takes place.
+       @param p any vertex of the graph.
+       @param marker the structure storing marked vertices, generally empty.
+    */
+    ParallelBreadthFirstVisitor( ConstAlias<Graph> graph, const Vertex & p,
+                                 const Marker & marker = Marker() );
+
+    /**
+       Constructor from iterators. The so specified set of vertices
+       provides the initial core of the breadth first traversal.
+       These vertices will all have a topological distance 0.
+
+       @tparam VertexIterator any type of single pass iterator on vertices.
+       @param graph the graph in which the breadth first traversal takes place.
+       @param b the begin iterator in a container of vertices.
+       @param e the end iterator in a container of vertices.
+       @param marker the structure storing marked vertices, generally empty.
+    */
+    template <typename VertexIterator>
+    ParallelBreadthFirstVisitor( ConstAlias<Graph> graph,
+                                 VertexIterator b, VertexIterator e,
+                                 const Marker & marker = Marker() );
+
+    /**
+       @return a const reference on the graph that is traversed.
+    */
+    const Graph & graph() const;
+
+    // ----------------------- Expansion services ------------------------------
+  public:
+
+    /**
+     * @return 'true' if all possible elements have been visited.
+     */
+    bool finished() const;
+
+    /**
+     * @return the current distance to the initial core, or
+     * equivalently the index of the current layer.
+     */
+    Size distance() const;
+
+    /**
+       Extracts the next layer, in parallel.
+
+       @return 'true' if there was another layer, or 'false' if it was
+       the last (ie. reverse of finished() ).
+     */
+    bool nextLayer();
+
+    /**
+       Extracts the next layer, in parallel, keeping only the vertices
+       that satisfy the predicate.
+
+       @tparam VertexPredicate a type that satisfies CPredicate on
+       Vertex, whose evaluation is thread-safe.
+       @param authorized_vtx the predicate that should satisfy the
+       visited vertices.
+
+       @return 'true' if there was another layer, or 'false' if it was
+       the last (ie. reverse of finished() ).
+     */
+    template <typename VertexPredicate>
+    bool nextLayer( const VertexPredicate & authorized_vtx );
+
+    /**
+     * @return a const reference on the current layer, sorted.
+     */
+    const VertexList & layer() const;
+
+    /**
+     * @return the iterator on the first element of the layer.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return the iterator after the last element of the layer.
+     */
+    ConstIterator end() const;
+
+    /**
+     * @return the marked vertices: the ones of the current layer and
+     * of the previous layers.
+     */
+    const Marker & marker() const;
+
+    /**
+     * @return the number of marked vertices.
+     */
+    Size nbMarked() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The graph where the traversal takes place.
+    const Graph & myGraph;
+    /// The marked vertices.
+    Marker myMarker;
+    /// The current layer.
+    VertexList myLayer;
+    /// Current distance to origin.
+    Size myDistance;
+    /// The number of marked vertices.
+    Size myNbMarked;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    ParallelBreadthFirstVisitor & operator= ( const ParallelBreadthFirstVisitor & other );
+
+  }; // end of class ParallelBreadthFirstVisitor
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ParallelBreadthFirstVisitor'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ParallelBreadthFirstVisitor' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TGraph, typename TMarker >
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ParallelBreadthFirstVisitor<TGraph, TMarker> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/graph/ParallelBreadthFirstVisitor.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ParallelBreadthFirstVisitor_h
+
+#undef ParallelBreadthFirstVisitor_RECURSES
+#endif // else defined(ParallelBreadthFirstVisitor_RECURSES)
@@ -0,0 +1,233 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ConnectedComponentLabeling.h
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module ConnectedComponentLabeling.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ConnectedComponentLabeling_RECURSES)
+#error Recursive header files inclusion detected in ConnectedComponentLabeling.h
+#else // defined(ConnectedComponentLabeling_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ConnectedComponentLabeling_RECURSES
+
+#if !defined ConnectedComponentLabeling_h
+/** Prevents repeated inclusion of headers. */
+#define ConnectedComponentLabeling_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ConnectedComponentLabeling
+  /**
+     Description of template class 'ConnectedComponentLabeling' <p>
+     \brief Aim: Labels the connected components of the points of a
+     HyperRectDomain that satisfy a predicate (e.g. the foreground of
+     an image), by raster scans and union-find, instead of flood
+     filling the components as Object::writeComponents does.
+
+     The domain is cut into slabs along its last axis. In a first
+     scan, each slab is labelled independently: each point of the
+     predicate gets the label of its neighbors already scanned in the
+     slab (the neighbors given by the adjacency that precede it in the
+     raster order), labels of different neighbors being merged in a
+     union-find structure with path compression. The slabs are
+     processed in parallel if DGtal has been built with OpenMP support
+     (WITH_OPENMP flag set to "true"). Labels of adjacent slabs are
+     then merged along their common boundary. A second parallel scan
+     writes the final labels and computes the statistics of each
+     component.
+
+     Labels are 1, 2, ..., nbComponents() by order of the first point
+     of each component in the raster scan of the domain (the first
+     axis being the fastest), and 0 for the points that do not
+     satisfy the predicate. Results do not depend on the number of
+     threads.
+
+     @code
+     typedef ImageContainerBySTLVector<Domain, unsigned char> Image;
+     typedef ConnectedComponentLabeling<Z3i::Adj26> Labeling;
+     Image image = ...;
+     Labeling::LabelImage labels( image.domain() );
+     Labeling labeling;
+     labeling.compute( functors::IntervalForegroundPredicate<Image>( image, 0, 255 ),
+                       labels );
+     for ( Labeling::Label l = 1; l <= labeling.nbComponents(); ++l )
+       std::cout << l << ": " << labeling.statistics( l ).size << std::endl;
+     @endcode
+
+     @tparam TAdjacency the adjacency of the points (e.g.
+     MetricAdjacency for 4/8 adjacencies in 2D, 6/18/26 adjacencies
+     in 3D), whose method writeNeighbors gives the neighbors of a
+     point, invariant by translation.
+
+     @tparam TLabel the integer type of labels, which should be able
+     to number all the components.
+   */
+  template <typename TAdjacency, typename TLabel = DGtal::uint32_t>
+  class ConnectedComponentLabeling
+  {
+  public:
+    typedef ConnectedComponentLabeling<TAdjacency, TLabel> Self;
+    typedef TAdjacency Adjacency;
+    typedef TLabel Label;
+    typedef typename Adjacency::Space Space;
+    typedef typename Space::Point Point;
+    typedef typename Space::Vector Vector;
+    typedef typename Space::RealPoint RealPoint;
+    typedef typename Space::Size Size;
+    typedef HyperRectDomain<Space> Domain;
+    /// The type of image of labels.
+    typedef ImageContainerBySTLVector<Domain, Label> LabelImage;
+
+    /// The statistics of a component.
+    struct ComponentStatistics
+    {
+      /// The number of points of the component.
+      Size size;
+      /// The lower bound of the bounding box of the component.
+      Point lowerBound;
+      /// The upper bound of the bounding box of the component.
+      Point upperBound;
+      /// The centroid of the points of the component.
+      RealPoint centroid;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Constructor.
+       @param adjacency the adjacency of the points.
+    */
+    ConnectedComponentLabeling( const Adjacency & adjacency = Adjacency() );
+
+    /**
+       Labels the connected components of the points of the domain of
+       \a labels that satisfy the predicate.
+
+       @tparam PointPredicate a model of concepts::CPointPredicate,
+       whose evaluation is thread-safe.
+       @param pred the predicate giving the points to label.
+       @param[out] labels the image of labels, whose domain is the
+       domain to scan.
+       @return the number of components.
+    */
+    template <typename PointPredicate>
+    Label compute( const PointPredicate & pred, LabelImage & labels );
+
+    /// @return the number of components found by the last computation.
+    Label nbComponents() const;
+
+    /**
+       @param l any label between 1 and nbComponents().
+       @return the statistics of the component with label \a l.
+    */
+    const ComponentStatistics & statistics( Label l ) const;
+
+    /// @return the statistics of the components, the i-th one being the one with label i+1.
+    const std::vector<ComponentStatistics> & statistics() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The neighbors of a point that precede it in the raster order, as vectors.
+    std::vector<Vector> myBackwardVectors;
+    /// The statistics of each component.
+    std::vector<ComponentStatistics> myStatistics;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       @param parent a union-find forest.
+       @param l any label.
+       @return the root of \a l, compressing the path from \a l.
+    */
+    static Label find( std::vector<Label> & parent, Label l );
+
+    /**
+       Merges the trees of two labels, the smallest root becoming the
+       root of the other.
+       @param parent a union-find forest.
+       @param l1 any label.
+       @param l2 any label.
+       @return the root of the merged tree.
+    */
+    static Label merge( std::vector<Label> & parent, Label l1, Label l2 );
+
+  }; // end of class ConnectedComponentLabeling
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ConnectedComponentLabeling'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ConnectedComponentLabeling' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TAdjacency, typename TLabel>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ConnectedComponentLabeling<TAdjacency, TLabel> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ConnectedComponentLabeling.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ConnectedComponentLabeling_h
+
+#undef ConnectedComponentLabeling_RECURSES
+#endif // else defined(ConnectedComponentLabeling_RECURSES)
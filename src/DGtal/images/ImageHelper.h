@@ -43,6 +43,8 @@
 #include <iostream>
 #include <algorithm>
 #include <functional>
+#include <vector>
+#include <boost/type_traits/is_same.hpp>
 
 #include "DGtal/base/Common.h"
 #include "DGtal/base/BasicFunctors.h"
@@ -56,6 +58,9 @@
 #include "DGtal/images/CImage.h"
 #include "DGtal/base/CQuantity.h"
 #include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/HyperRectDomainParallel.h"
 #include "DGtal/images/SetValueIterator.h"
 #include "DGtal/kernel/sets/DigitalSetFromMap.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
@@ -126,6 +131,24 @@ namespace DGtal
 		    const O& ito, 
 		    const typename I::Value& aThreshold = 0); 
 
+  /**
+   * Same as setFromImage, but slabs of the domain are scanned in
+   * parallel (see parallelForEachSubDomain), the points being
+   * inserted afterwards in the order of the domain.
+   *
+   * @param aImg an image stored by lexicographic index on a HyperRectDomain
+   * @param ito set inserter
+   * @param aThreshold any value
+   *
+   * @tparam TSpace any digital space
+   * @tparam TValue image value type
+   * @tparam O any model of output iterator
+   */
+  template<typename TSpace, typename TValue, typename O>
+  void parallelSetFromImage(const ImageContainerBySTLVector<HyperRectDomain<TSpace>, TValue>& aImg, 
+                            const O& ito, 
+                            const TValue& aThreshold); 
+
   /**
    * Fill a set through the inserter @a ito
    * with the points lying within the domain 
@@ -147,6 +170,25 @@ namespace DGtal
 		    const typename I::Value& low,
 		    const typename I::Value& up); 
 
+  /**
+   * Same as setFromImage, but slabs of the domain are scanned in
+   * parallel, as above.
+   *
+   * @param aImg an image stored by lexicographic index on a HyperRectDomain
+   * @param ito set inserter
+   * @param low lower value
+   * @param up upper value
+   *
+   * @tparam TSpace any digital space
+   * @tparam TValue image value type
+   * @tparam O any model of output iterator
+   */
+  template<typename TSpace, typename TValue, typename O>
+  void parallelSetFromImage(const ImageContainerBySTLVector<HyperRectDomain<TSpace>, TValue>& aImg, 
+                            const O& ito, 
+                            const TValue& low,
+                            const TValue& up); 
+
 
   /**
    * Set the values of @a aImg at @a aValue
@@ -192,6 +234,41 @@ namespace DGtal
   template<typename I, typename F>
   void imageFromFunctor(I& aImg, const F& aFun); 
 
+  /**
+   * In a window corresponding to the domain of @a aImg, 
+   * copy the values of @a aFun into @a aImg. 
+   * Overload for images stored by lexicographic index on a
+   * HyperRectDomain: values are written scanline by scanline into
+   * contiguous storage, without any iterator increment or index
+   * computation per point.
+   *
+   * @param aImg (returned) image
+   * @param aFun a unary functor
+   *
+   * @tparam TSpace any digital space
+   * @tparam TValue image value type
+   * @tparam F any model of CPointFunctor
+   */
+  template<typename TSpace, typename TValue, typename F>
+  void imageFromFunctor(ImageContainerBySTLVector<HyperRectDomain<TSpace>, TValue>& aImg, const F& aFun); 
+
+  /**
+   * Same as imageFromFunctor, but slabs of the domain are filled in
+   * parallel (see parallelForEachSubDomain), each with its own copy
+   * of @a aFun. The copies are made before the parallel loop, but
+   * they are then evaluated concurrently: the data they share (e.g.
+   * through pointers) must be safe to read from several threads.
+   *
+   * @param aImg (returned) image
+   * @param aFun a unary functor
+   *
+   * @tparam TSpace any digital space
+   * @tparam TValue image value type
+   * @tparam F any model of CPointFunctor
+   */
+  template<typename TSpace, typename TValue, typename F>
+  void parallelImageFromFunctor(ImageContainerBySTLVector<HyperRectDomain<TSpace>, TValue>& aImg, const F& aFun); 
+
   /**
    * Copy the values of @a aImg2 into @a aImg1 .
    *
@@ -204,6 +281,37 @@ namespace DGtal
   template<typename I1, typename I2>
   void imageFromImage(I1& aImg1, const I2& aImg2); 
 
+  /**
+   * Copy the values of @a aImg2 into @a aImg1 .
+   * Overload for images stored by lexicographic index on a
+   * HyperRectDomain: the storage is copied directly.
+   *
+   * @param aImg1 the image to fill, at least as large as @a aImg2
+   * @param aImg2 the image to copy
+   *
+   * @tparam TSpace any digital space
+   * @tparam TValue1 value type of @a aImg1
+   * @tparam TValue2 value type of @a aImg2, convertible to TValue1
+   */
+  template<typename TSpace, typename TValue1, typename TValue2>
+  void imageFromImage(ImageContainerBySTLVector<HyperRectDomain<TSpace>, TValue1>& aImg1, 
+                      const ImageContainerBySTLVector<HyperRectDomain<TSpace>, TValue2>& aImg2); 
+
+  /**
+   * Same as imageFromImage, but slabs of the storage are copied in
+   * parallel (see parallelForEachSubDomain).
+   *
+   * @param aImg1 the image to fill, at least as large as @a aImg2
+   * @param aImg2 the image to copy
+   *
+   * @tparam TSpace any digital space
+   * @tparam TValue1 value type of @a aImg1
+   * @tparam TValue2 value type of @a aImg2, convertible to TValue1
+   */
+  template<typename TSpace, typename TValue1, typename TValue2>
+  void parallelImageFromImage(ImageContainerBySTLVector<HyperRectDomain<TSpace>, TValue1>& aImg1, 
+                              const ImageContainerBySTLVector<HyperRectDomain<TSpace>, TValue2>& aImg2); 
+
   /**
    * Insert @a aPoint in @a aSet and if (and only if)
    * @a aPoint is a newly inserted point. 
@@ -120,6 +120,9 @@ namespace DGtal
     
     typedef functors::IsWithinPointPredicate<Point> Predicate;
 
+    typedef HyperRectDomain_Scanline<Point, Size> Scanline;
+    typedef HyperRectDomain_ScanlineIterator<Point, Size> ConstScanlineIterator;
+
     /**
      * Default Constructor.
      */
@@ -540,9 +543,87 @@ namespace DGtal
         return ConstSubRange(*this, permutation, startingPoint);
       }
     
+    /**
+     * Description of class 'ConstScanlineRange' <p> \brief Aim:
+     * range through the scanlines of the domain, i.e. its rows along
+     * the first dimension, in lexicographic order. Points of a
+     * scanline are consecutive in lexicographic order, so that their
+     * values in an image stored by lexicographic index (e.g.
+     * ImageContainerBySTLVector) are contiguous.
+     *
+     * @code
+     * for ( Domain::ConstScanlineIterator it = domain.scanlines().begin(),
+     *         itEnd = domain.scanlines().end(); it != itEnd; ++it )
+     *   {
+     *     Point p = it->start;
+     *     for ( Domain::Size k = 0; k < it->length; ++k, ++p[0] )
+     *       image[ it->offset + k ] = f( p );
+     *   }
+     * @endcode
+     */
+    struct ConstScanlineRange
+    {
+      typedef ConstScanlineIterator ConstIterator;
+
+      /**
+       * ConstScanlineRange constructor from a given domain.
+       * @param domain the domain.
+       */
+      ConstScanlineRange(const HyperRectDomain<TSpace>& domain)
+        : myLowerBound( domain.lowerBound() ), myUpperBound( domain.upperBound() ),
+          mySize( domain.isEmpty() ? 0 : domain.size() )
+        {}
+
+      /**
+       * begin method.
+       * @return ConstIterator on the first scanline.
+       */
+      ConstIterator begin() const
+        {
+          return ConstIterator( myLowerBound, 0, myLowerBound, myUpperBound );
+        }
+
+      /**
+       * end method.
+       * @return ConstIterator past the last scanline.
+       */
+      ConstIterator end() const
+        {
+          return ConstIterator( myLowerBound, mySize, myLowerBound, myUpperBound );
+        }
+
+    private:
+      /// Bounds of the domain
+      Point myLowerBound, myUpperBound;
+      /// Number of points of the domain
+      Size mySize;
+    }; // ConstScanlineRange
+
+    /**
+     * get the range of scanlines.
+     * @return a ConstScanlineRange.
+     */
+    ConstScanlineRange scanlines() const
+      {
+        return ConstScanlineRange( *this );
+      }
+
     // ----------------------- Interface --------------------------------------
   public:
 
+    /**
+     * @return the number of scanlines, i.e. rows along the first
+     * dimension, of the HyperRectDomain.
+     */
+    Size nbScanlines() const;
+
+    /**
+     * Random access to scanlines, e.g. to process them in parallel.
+     * @param anIndex index of the scanline, lower than nbScanlines().
+     * @return the scanline.
+     */
+    Scanline scanline( Size anIndex ) const;
+
     /**
      * @return  the size (number of points) of the HyperRectDomain
      *
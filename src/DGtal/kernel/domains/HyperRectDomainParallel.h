@@ -0,0 +1,167 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file HyperRectDomainParallel.h
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module HyperRectDomainParallel.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(HyperRectDomainParallel_RECURSES)
+#error Recursive header files inclusion detected in HyperRectDomainParallel.h
+#else // defined(HyperRectDomainParallel_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define HyperRectDomainParallel_RECURSES
+
+#if !defined HyperRectDomainParallel_h
+/** Prevents repeated inclusion of headers. */
+#define HyperRectDomainParallel_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /**
+   * @name Parallel loops over HyperRectDomain
+   *
+   * These functions split a HyperRectDomain into slabs, i.e.
+   * sub-domains cut across its last non-degenerated dimension, and
+   * process the slabs in parallel when DGtal is built with OpenMP
+   * (sequentially otherwise). Since the first dimension is the
+   * fastest in the lexicographic order, each slab is a contiguous
+   * block of an ImageContainerBySTLVector defined on the domain,
+   * starting at the offset given to the slab functor, so that
+   * workers never share cache lines except at slab boundaries.
+   *
+   * Functors are shared by all the workers and must be thread-safe
+   * (e.g. only read shared data and write to points of their own
+   * slab).
+   *
+   * @code
+   * // sum of the values of an image, in parallel
+   * double sum = parallelReduce( image.domain(), 0.,
+   *                              image, std::plus<double>() );
+   * @endcode
+   * @{
+   */
+
+  /**
+   * Splits a domain into slabs across its last dimension whose
+   * extent is greater than one. The slabs are given in lexicographic
+   * order and have the same extent up to one.
+   *
+   * @param aDomain any domain.
+   * @param nbSlabs the maximal number of slabs.
+   * @return the slabs, none if @a aDomain is empty.
+   *
+   * @tparam TSpace any model of CSpace.
+   */
+  template <typename TSpace>
+  std::vector< HyperRectDomain<TSpace> >
+  splitDomainIntoSlabs( const HyperRectDomain<TSpace> & aDomain,
+                        std::size_t nbSlabs );
+
+  /**
+   * Calls @a aFunctor on each slab of a domain, in parallel.
+   *
+   * @param aDomain any domain.
+   * @param aFunctor called as aFunctor( index, slab, offset ) where
+   * index is the rank of the slab in lexicographic order and offset
+   * is the lexicographic index of the lower bound of the slab in @a
+   * aDomain.
+   * @param nbSlabs the maximal number of slabs.
+   *
+   * @tparam TSpace any model of CSpace.
+   * @tparam TFunctor the type of the slab functor.
+   */
+  template <typename TSpace, typename TFunctor>
+  void
+  parallelForEachSubDomain( const HyperRectDomain<TSpace> & aDomain,
+                            const TFunctor & aFunctor,
+                            std::size_t nbSlabs = 64 );
+
+  /**
+   * Calls @a aFunctor on each point of a domain, in parallel. The
+   * points of a slab are visited in lexicographic order.
+   *
+   * @param aDomain any domain.
+   * @param aFunctor called as aFunctor( point ).
+   * @param nbSlabs the maximal number of slabs.
+   *
+   * @tparam TSpace any model of CSpace.
+   * @tparam TFunctor the type of the point functor.
+   */
+  template <typename TSpace, typename TFunctor>
+  void
+  parallelForEach( const HyperRectDomain<TSpace> & aDomain,
+                   const TFunctor & aFunctor,
+                   std::size_t nbSlabs = 64 );
+
+  /**
+   * Reduces the values of @a aMap on the points of a domain, in
+   * parallel. Each slab is reduced in lexicographic order, then
+   * partial results are reduced in slab order from @a anInit, so
+   * that the result does not depend on the number of threads.
+   *
+   * @param aDomain any domain.
+   * @param anInit the initial value.
+   * @param aMap called as aMap( point ), returns a value convertible to TValue.
+   * @param aReduce called as aReduce( value, value ), must be associative.
+   * @param nbSlabs the maximal number of slabs.
+   * @return the reduction of @a anInit and all the mapped values.
+   *
+   * @tparam TSpace any model of CSpace.
+   * @tparam TValue the type of the result.
+   * @tparam TMap the type of the point functor.
+   * @tparam TReduce the type of the binary functor.
+   */
+  template <typename TSpace, typename TValue, typename TMap, typename TReduce>
+  TValue
+  parallelReduce( const HyperRectDomain<TSpace> & aDomain,
+                  const TValue & anInit,
+                  const TMap & aMap,
+                  const TReduce & aReduce,
+                  std::size_t nbSlabs = 64 );
+
+  /** @} */
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/domains/HyperRectDomainParallel.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined HyperRectDomainParallel_h
+
+#undef HyperRectDomainParallel_RECURSES
+#endif // else defined(HyperRectDomainParallel_RECURSES)
@@ -546,6 +546,113 @@ namespace DGtal
     std::vector<Dimension> mySubDomain;
   }; // End of class HyperRectDomain_subIterator
 
+  /////////////////////////////////////////////////////////////////////////////
+  // struct HyperRectDomain_Scanline
+  /**
+   * Description of struct 'HyperRectDomain_Scanline' <p>
+   * Aim: row of a HyperRectDomain along its first dimension, given by
+   * its first point, the lexicographic index of this point in the
+   * domain (which is also its index in an ImageContainerBySTLVector
+   * defined on the domain) and its number of points.
+   */
+  template<typename TPoint, typename TSize>
+  struct HyperRectDomain_Scanline
+  {
+    typedef TPoint Point;
+    typedef TSize Size;
+
+    /// First point of the row.
+    Point start;
+    /// Lexicographic index of the first point in the domain.
+    Size offset;
+    /// Number of points of the row.
+    Size length;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class HyperRectDomain_ScanlineIterator
+  /**
+   * Description of class 'HyperRectDomain_ScanlineIterator' <p>
+   * Aim: iterates over the rows of a HyperRectDomain along its first
+   * dimension, in lexicographic order. Incrementing the iterator only
+   * carries over the higher dimensions once per row.
+   */
+  template<typename TPoint, typename TSize>
+  class HyperRectDomain_ScanlineIterator
+  {
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef HyperRectDomain_Scanline<TPoint, TSize> value_type;
+    typedef ptrdiff_t difference_type;
+    typedef const value_type* pointer;
+    typedef const value_type& reference;
+    typedef typename TPoint::Dimension Dimension;
+
+    /**
+     * Constructor.
+     * @param aStart first point of the current row.
+     * @param anOffset lexicographic index of aStart, the domain size for the end iterator.
+     * @param lower lower bound of the domain.
+     * @param upper upper bound of the domain.
+     */
+    HyperRectDomain_ScanlineIterator(const TPoint& aStart, const TSize anOffset,
+                                     const TPoint& lower, const TPoint& upper)
+      : mylower( lower ), myupper( upper )
+      {
+        myScanline.start = aStart;
+        myScanline.offset = anOffset;
+        myScanline.length = static_cast<TSize>( upper[0] - lower[0] + 1 );
+      }
+
+    reference operator*() const
+      {
+        return myScanline;
+      }
+
+    pointer operator->() const
+      {
+        return &myScanline;
+      }
+
+    bool operator==(const HyperRectDomain_ScanlineIterator& other) const
+      {
+        return myScanline.offset == other.myScanline.offset;
+      }
+
+    bool operator!=(const HyperRectDomain_ScanlineIterator& other) const
+      {
+        return myScanline.offset != other.myScanline.offset;
+      }
+
+    HyperRectDomain_ScanlineIterator& operator++()
+      {
+        myScanline.offset += myScanline.length;
+        for ( Dimension dim = 1; dim < TPoint::dimension; ++dim )
+          {
+            if ( myScanline.start[dim] < myupper[dim] )
+              {
+                ++myScanline.start[dim];
+                return *this;
+              }
+            myScanline.start[dim] = mylower[dim];
+          }
+        return *this;
+      }
+
+    HyperRectDomain_ScanlineIterator operator++(int)
+      {
+        HyperRectDomain_ScanlineIterator tmp( *this );
+        ++( *this );
+        return tmp;
+      }
+
+  private:
+    ///Current row
+    value_type myScanline;
+    ///Copies of the Domain limits
+    TPoint mylower, myupper;
+  }; // End of class HyperRectDomain_ScanlineIterator
+
 } //namespace
 //                                                                           //
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,560 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByBitVector.h
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module DigitalSetByBitVector.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetByBitVector_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByBitVector.h
+#else // defined(DigitalSetByBitVector_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByBitVector_RECURSES
+
+#if !defined DigitalSetByBitVector_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByBitVector_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <string>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CowPtr.h"
+#include "DGtal/base/Clone.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByBitVector
+  /**
+    Description of template class 'DigitalSetByBitVector' <p> \brief
+    Aim: Realizes the concept CDigitalSet by a bit array covering the
+    whole domain, one bit per point.
+
+    This is the set to use for dense objects (e.g. thresholded images
+    or digitized shapes filling a large part of their domain): it
+    needs one bit per point of the domain whatever the number of
+    points of the set, membership is a bit test and the points are
+    enumerated in the raster order of the domain (the first axis being
+    the fastest).
+
+    The bits are stored in 64-bit words, row by row, a row being the
+    points of the domain with the same coordinates except the first
+    one. Each row starts on a new word. Beyond CDigitalSet services,
+    this layout gives fast implementations of operations that work on
+    whole rows:
+
+    - assignFromBorder() computes the border of a set by shifting and
+      combining the rows of its complement, instead of looking at the
+      neighbors of each point;
+
+    - computeNbComponents() counts the connected components of a set
+      by union-find on its runs (maximal sequences of consecutive
+      points along a row).
+
+    Both are done in parallel if DGtal has been built with OpenMP
+    support (WITH_OPENMP flag set to "true"). Object::border() and
+    Object::computeConnectedness() use them when the point set of the
+    object is a DigitalSetByBitVector.
+
+    @tparam TDomain a HyperRectDomain.
+    @see CDigitalSet, DigitalSetBySTLVector
+   */
+  template <typename TDomain>
+  class DigitalSetByBitVector
+  {
+  public:
+    typedef TDomain Domain;
+    typedef DigitalSetByBitVector<Domain> Self;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Size Size;
+    typedef typename Point::Coordinate Coordinate;
+    /// The type of the words storing the bits.
+    typedef DGtal::uint64_t Word;
+
+    /**
+       Iterator visiting the points of the set in the raster order of
+       the domain. It remains valid while points are inserted or
+       erased, except the one it points to.
+    */
+    class ConstIterator
+      : public boost::iterator_facade< ConstIterator, Point const,
+                                       std::forward_iterator_tag >
+    {
+      friend class DigitalSetByBitVector;
+    public:
+      /// Default iterator. Invalid.
+      ConstIterator() : mySet( 0 ), myIndex( 0 ) {}
+
+    private:
+      friend class boost::iterator_core_access;
+
+      /**
+         Constructor.
+         @param aSet the set in which the iterator moves.
+         @param index the index of the bit it points to.
+      */
+      ConstIterator( const DigitalSetByBitVector* aSet, std::size_t index )
+        : mySet( aSet ), myIndex( index )
+      {
+        if ( myIndex != mySet->nbBits() ) myPoint = mySet->point( myIndex );
+      }
+
+      void increment()
+      {
+        ASSERT( mySet != 0 );
+        myIndex = mySet->nextBit( myIndex + 1 );
+        if ( myIndex != mySet->nbBits() ) myPoint = mySet->point( myIndex );
+      }
+
+      bool equal( const ConstIterator & other ) const
+      {
+        return myIndex == other.myIndex;
+      }
+
+      Point const & dereference() const
+      {
+        return myPoint;
+      }
+
+    private:
+      /// the set in which the iterator moves.
+      const DigitalSetByBitVector* mySet;
+      /// the index of the bit the iterator points to.
+      std::size_t myIndex;
+      /// the point the iterator points to.
+      Point myPoint;
+    };
+    typedef ConstIterator Iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetByBitVector();
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any HyperRectDomain.
+     */
+    DigitalSetByBitVector( Clone<Domain> d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByBitVector ( const DigitalSetByBitVector & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitVector & operator= ( const DigitalSetByBitVector & other );
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return a copy-on-write pointer on the embedding domain.
+     */
+    CowPtr<Domain> domainPointer() const;
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set if the point is not already in the
+     * set (same as insert).
+     *
+     * @param p any digital point.
+     *
+     * @pre p should belong to the associated domain.
+     * @pre p should not belong to this.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set (same as insert).
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     *
+     * @pre all points should belong to the associated domain.
+     * @pre each point should not belong to this.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds the \a n consecutive points of a row starting at [p], i.e.
+     * p, p + e_0, ..., p + (n-1) e_0, by setting whole words at once.
+     *
+     * @param p any digital point.
+     * @param n the number of points.
+     * @pre all these points should belong to the associated domain.
+     */
+    void insertRun( const Point & p, Size n );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set.
+     *
+     * @param it an iterator on this set.
+     * @pre it should point on a valid element ( it != end() ).
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Clears the set.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * @param p any digital point.
+     * @return a const iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return a const iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * set union to left.
+     * @param aSet any other set.
+     */
+    DigitalSetByBitVector<Domain> & operator+=
+    ( const DigitalSetByBitVector<Domain> & aSet );
+
+    // ----------------------- Model of concepts::CPointPredicate -------------
+  public:
+
+    /**
+       @param p any point.
+       @return 'true' if and only if \a p belongs to this set.
+    */
+    bool operator()( const Point & p ) const;
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * Computes the complement in the domain of this set
+     * @param ito an output iterator
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template< typename TOutputIterator >
+    void computeComplement(TOutputIterator& ito) const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const DigitalSetByBitVector<Domain> & other_set );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    // ----------------------- Row services -----------------------------------
+  public:
+
+    /**
+       Builds in this the border of the set [other_set], i.e. its
+       points that are adjacent to a point of the domain that does not
+       belong to it. For each neighbor vector of the adjacency, the
+       rows of the complement of [other_set] are shifted by this
+       vector and intersected with the rows of [other_set].
+
+       @tparam Adjacency any adjacency whose method writeNeighbors
+       gives the neighbors of a point, invariant by translation (e.g.
+       MetricAdjacency).
+
+       @param other_set any set with the same domain as this.
+       @param adjacency the adjacency between a point of the border
+       and a point of the complement.
+    */
+    template <typename Adjacency>
+    void assignFromBorder( const DigitalSetByBitVector<Domain> & other_set,
+                           const Adjacency & adjacency );
+
+    /**
+       Counts the connected components of this set, by union-find on
+       its runs, the domain being cut in slabs along its last axis.
+
+       @tparam Adjacency any symmetric adjacency whose method
+       writeNeighbors gives the neighbors of a point, invariant by
+       translation, consecutive points of a row being adjacent (e.g.
+       MetricAdjacency).
+
+       @param adjacency the adjacency between the points of the set.
+       @return the number of connected components of this set.
+    */
+    template <typename Adjacency>
+    Size computeNbComponents( const Adjacency & adjacency ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /**
+     * The associated domain. The pointed domain may be changed but it
+     * remains valid during the lifetime of the set.
+     */
+    CowPtr<Domain> myDomain;
+
+    /// The number of points of the domain along each axis.
+    Point myExtent;
+    /// The number of words of a row.
+    std::size_t myNbWordsPerRow;
+    /// The number of rows.
+    std::size_t myNbRows;
+    /// The mask of the bits of the last word of a row that are in the domain.
+    Word myLastWordMask;
+    /// The words storing the bits, row by row.
+    std::vector<Word> myWords;
+    /// The number of points of the set.
+    Size mySize;
+
+    // --------------- CDrawableWithBoard2D realization --------------------
+  public:
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByBitVector();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// A run of a row, given by the indices of its first and last points.
+    typedef std::pair<std::size_t, std::size_t> Run;
+
+    /// @return the number of bits of the words.
+    std::size_t nbBits() const;
+
+    /**
+       @param p any point of the domain.
+       @return the index of its bit.
+    */
+    std::size_t index( const Point & p ) const;
+
+    /**
+       @param i the index of a bit of a row.
+       @return the point of this bit.
+    */
+    Point point( std::size_t i ) const;
+
+    /**
+       @param i the index of a bit.
+       @return the index of the first set bit from \a i, or nbBits().
+    */
+    std::size_t nextBit( std::size_t i ) const;
+
+    /**
+       @param r any row.
+       @param v any vector.
+       @param[out] rv the row of the points of \a r translated by \a v.
+       @return 'true' if this row lies in the domain.
+    */
+    bool translatedRow( std::size_t r, const Point & v, std::size_t & rv ) const;
+
+    /**
+       Writes the runs of the row \a r of the set.
+       @param r any row.
+       @param[out] runs the runs of the row, from left to right.
+    */
+    void writeRuns( std::size_t r, std::vector<Run> & runs ) const;
+
+    /// Recomputes the number of points of the set from its bits.
+    void updateSize();
+
+    /// @return the number of set bits of \a w.
+    static unsigned int popCount( Word w );
+
+    /// @return the index of the lowest set bit of \a w, which is non zero.
+    static unsigned int lowestBit( Word w );
+
+    /**
+       @param parent a union-find forest.
+       @param i any node.
+       @return the root of \a i, compressing the path from \a i.
+    */
+    static std::size_t find( std::vector<std::size_t> & parent, std::size_t i );
+
+    /**
+       Merges the trees of two nodes, the smallest root becoming the
+       root of the other.
+       @param parent a union-find forest.
+       @param i any node.
+       @param j any node.
+    */
+    static void merge( std::vector<std::size_t> & parent,
+                       std::size_t i, std::size_t j );
+
+    /**
+       Merges the runs of a row with the runs of another row that are
+       adjacent to them along a vector.
+
+       @param parent a union-find forest on runs.
+       @param runs1 the first run of the first row.
+       @param runs1End the run after the last one of the first row.
+       @param first1 the number of the run \a runs1.
+       @param runs2 the first run of the second row.
+       @param runs2End the run after the last one of the second row.
+       @param first2 the number of the run \a runs2.
+       @param dx the first coordinate of the vector from a point of
+       the first row to a point of the second row.
+    */
+    static void mergeRuns( std::vector<std::size_t> & parent,
+                           const Run* runs1, const Run* runs1End,
+                           std::size_t first1,
+                           const Run* runs2, const Run* runs2End,
+                           std::size_t first2, Coordinate dx );
+
+  }; // end of class DigitalSetByBitVector
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByBitVector'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByBitVector' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const DigitalSetByBitVector<Domain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByBitVector.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByBitVector_h
+
+#undef DigitalSetByBitVector_RECURSES
+#endif // else defined(DigitalSetByBitVector_RECURSES)
@@ -0,0 +1,225 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file CompiledMPolynomial3.h
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module CompiledMPolynomial3.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(CompiledMPolynomial3_RECURSES)
+#error Recursive header files inclusion detected in CompiledMPolynomial3.h
+#else // defined(CompiledMPolynomial3_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define CompiledMPolynomial3_RECURSES
+
+#if !defined CompiledMPolynomial3_h
+/** Prevents repeated inclusion of headers. */
+#define CompiledMPolynomial3_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/math/MPolynomial.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class CompiledMPolynomial3
+  /**
+     Description of template class 'CompiledMPolynomial3' <p>
+     \brief Aim: A polynomial in 3 variables compiled into flat
+     arrays, for fast evaluation in nested Horner form.
+
+     An MPolynomial<3> is a polynomial in X_0 whose coefficients are
+     polynomials in X_1, themselves with coefficients polynomials in
+     X_2. Its evaluation goes through this nested structure and
+     computes the powers of each variable. Once compiled, the
+     polynomial is a stream of degrees and a stream of coefficients,
+     both in the order of the evaluation
+
+     P(x,y,z) = ( ... ( P_d(y,z) x + P_{d-1}(y,z) ) x + ... ) x + P_0(y,z),
+
+     where each P_i(y,z) and each of its coefficients in y are
+     evaluated the same way. Evaluation is then a few tight loops
+     without allocation.
+
+     Besides the evaluation at one point, the object evaluates a
+     batch of points (given as arrays of coordinates), the loops over
+     the points being innermost so that the compiler may vectorize
+     them, or a row of points that differ only by their first
+     coordinate, the coefficients P_i(y,z) being computed once for the
+     whole row. All evaluators perform the same operations in the
+     same order, hence give the same results.
+
+     @code
+     MPolynomial<3, double> P = ...;
+     CompiledMPolynomial3<double> CP( P );
+     double v = CP( 0.5, 1.0, -2.0 );
+     CompiledMPolynomial3<double> CPx( derivative<0>( P ) );
+     @endcode
+
+     @tparam TRing the type of the coefficients and of the variables
+     (generally float or double).
+
+     @see MPolynomial, ImplicitPolynomial3Shape
+  */
+  template <typename TRing>
+  class CompiledMPolynomial3
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef CompiledMPolynomial3<TRing> Self;
+    typedef TRing Ring;
+    typedef MPolynomial< 3, Ring > Polynomial3;
+    typedef std::size_t Size;
+
+    /// Number of points evaluated together by the batch evaluators.
+    static const Size BatchSize = 64;
+
+    /**
+     * Destructor.
+     */
+    ~CompiledMPolynomial3();
+
+    /**
+     * Constructor. The zero polynomial.
+     */
+    CompiledMPolynomial3();
+
+    /**
+     * Constructor.
+     * @param P any polynomial in 3 variables.
+     */
+    CompiledMPolynomial3( const Polynomial3 & P );
+
+    /**
+     * Compiles the given polynomial.
+     * @param P any polynomial in 3 variables.
+     */
+    void init( const Polynomial3 & P );
+
+    /**
+       @return the degree of the polynomial in X_0, -1 for the zero polynomial.
+    */
+    int degree() const;
+
+    /**
+       @return the number of (possibly zero) coefficients in the compiled form.
+    */
+    Size nbCoefficients() const;
+
+    /**
+       @param x the value of X_0.
+       @param y the value of X_1.
+       @param z the value of X_2.
+       @return the value of the polynomial at (x,y,z).
+    */
+    Ring operator()( const Ring & x, const Ring & y, const Ring & z ) const;
+
+    /**
+       Evaluates the polynomial at a batch of points.
+
+       @param x the values of X_0 (n values).
+       @param y the values of X_1 (n values).
+       @param z the values of X_2 (n values).
+       @param[out] values the values of the polynomial (n values).
+       @param n the number of points.
+    */
+    void evaluate( const Ring* x, const Ring* y, const Ring* z,
+                   Ring* values, Size n ) const;
+
+    /**
+       Evaluates the polynomial at a row of points (x[i],y,z).
+
+       @param x the values of X_0 (n values).
+       @param y the value of X_1.
+       @param z the value of X_2.
+       @param[out] values the values of the polynomial (n values).
+       @param n the number of points.
+    */
+    void evaluateRow( const Ring* x, const Ring & y, const Ring & z,
+                      Ring* values, Size n ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// Degree in X_0, -1 for the zero polynomial.
+    int myDegree;
+
+    /// For i from myDegree down to 0, the degree in X_1 of P_i,
+    /// followed by the degrees in X_2 of its coefficients, from the
+    /// highest power of X_1 down to the lowest.
+    std::vector<int> myDegrees;
+
+    /// The coefficients, in the order of the Horner evaluation.
+    std::vector<Ring> myCoefficients;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+  }; // end of class CompiledMPolynomial3
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'CompiledMPolynomial3'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'CompiledMPolynomial3' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TRing>
+  std::ostream&
+  operator<< ( std::ostream & out, const CompiledMPolynomial3<TRing> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/math/CompiledMPolynomial3.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined CompiledMPolynomial3_h
+
+#undef CompiledMPolynomial3_RECURSES
+#endif // else defined(CompiledMPolynomial3_RECURSES)
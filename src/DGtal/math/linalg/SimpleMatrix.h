@@ -202,6 +202,15 @@ namespace DGtal
      */
     bool operator==(const Self & aMatrix) const;
 
+    /**
+     * Assignment operator, matching the copy constructor.
+     *
+     * @param aMatrix the matrix to copy.
+     *
+     * @return reference on the matrix
+     */
+    Self & operator=(const Self& aMatrix);
+
     /**
      * Assignment operator from another matrix.
      * Note: a static_cast from TComponentOther to Component is performed.
@@ -44,8 +44,12 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <iterator>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/HyperRectDomainParallel.h"
 #include "DGtal/kernel/RegularPointEmbedder.h"
 #include "DGtal/shapes/CEuclideanOrientedShape.h"
 #include "DGtal/shapes/CEuclideanBoundedShape.h"
@@ -87,6 +91,10 @@ namespace DGtal
     typedef TEuclideanShape EuclideanShape;
     typedef HyperRectDomain<Space> Domain;
     typedef RegularPointEmbedder<Space> PointEmbedder;
+    typedef typename Domain::Size Size;
+    /// A run of consecutive digital points along the first axis,
+    /// with the lexicographic index of its first point in the domain.
+    typedef typename Domain::Scanline Run;
 
     // JOL: GaussDigitizer do not need a bounded shape.
     // BOOST_CONCEPT_ASSERT(( CEuclideanBoundedShape<TEuclideanShape> ));
@@ -206,6 +214,47 @@ namespace DGtal
      */
     bool operator()( const Point & p ) const;
 
+    /**
+     * Digitizes a row of points: outputs the maximal runs of its
+     * points that are inside or on the shape, from left to right.
+     * The row is embedded once and only the first coordinate is
+     * updated from one point to the next, and the shape is evaluated
+     * once per point.
+     *
+     * @tparam OutputIterator an output iterator on Run.
+     * @param aScanline any row of points, e.g. a scanline of getDomain().
+     * @param out the output iterator where runs are written, their
+     * offsets being computed from the offset of @a aScanline.
+     * @return the output iterator after the last run.
+     */
+    template <typename OutputIterator>
+    OutputIterator digitizeScanline( const Run & aScanline, OutputIterator out ) const;
+
+    /**
+     * Digitizes the whole domain as runs, i.e. a run-length encoding
+     * of the digitized shape in the lexicographic order of
+     * getDomain(), scanline by scanline.
+     *
+     * @tparam OutputIterator an output iterator on Run.
+     * @param out the output iterator where runs are written.
+     * @return the output iterator after the last run.
+     */
+    template <typename OutputIterator>
+    OutputIterator digitizeRuns( OutputIterator out ) const;
+
+    /**
+     * Same as digitizeRuns, but slabs of the domain are digitized in
+     * parallel (see parallelForEachSubDomain), so the orientation of
+     * the attached shape must be safe to call from several threads.
+     * Runs are written in the same order.
+     *
+     * @tparam OutputIterator an output iterator on Run.
+     * @param out the output iterator where runs are written.
+     * @return the output iterator after the last run.
+     */
+    template <typename OutputIterator>
+    OutputIterator parallelDigitizeRuns( OutputIterator out ) const;
+
     /**
        @return the lowest admissible digital point.
        @see init
@@ -266,6 +315,30 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /// Slab functor writing the runs of the scanlines of a slab, see parallelDigitizeRuns.
+    struct DigitizeSlab
+    {
+      DigitizeSlab( const GaussDigitizer & aDigitizer, 
+                    std::vector< std::vector<Run> > & someRuns )
+        : myDigitizer( &aDigitizer ), myRuns( &someRuns ) {}
+
+      void operator()( std::size_t anIndex, const Domain & aSlab, Size anOffset ) const
+      {
+        std::back_insert_iterator< std::vector<Run> > out( ( *myRuns )[ anIndex ] );
+        const typename Domain::ConstScanlineRange r = aSlab.scanlines();
+        for ( typename Domain::ConstScanlineIterator it = r.begin(), itEnd = r.end(); 
+              it != itEnd; ++it )
+          {
+            Run aScanline = *it;
+            aScanline.offset += anOffset;
+            out = myDigitizer->digitizeScanline( aScanline, out );
+          }
+      }
+
+      const GaussDigitizer* myDigitizer;
+      std::vector< std::vector<Run> >* myRuns;
+    };
+
   }; // end of class GaussDigitizer
 
 
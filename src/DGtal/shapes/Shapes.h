@@ -45,6 +45,7 @@
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/kernel/domains/CDomain.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/sets/DigitalSetByBitVector.h"
 #include "DGtal/topology/KhalimskySpaceND.h"
 #include "DGtal/topology/SurfelAdjacency.h"
 #include "DGtal/topology/helpers/Surfaces.h"
@@ -110,7 +111,9 @@ namespace DGtal
      * an instance of ShapeFunctor. Add Points where orientation is inside.
      * The shape functor must be a model of CEuclideanOrientedShape
      * and CEuclideanBoundedShape. The underlying digitization process is
-     * a Gauss Digitizer with grid step h.
+     * a Gauss Digitizer with grid step h. The domain is digitized as
+     * runs (see GaussDigitizer::digitizeRuns), which are inserted
+     * word by word in a DigitalSetByBitVector.
      * 
      * @param aSet the set (modified) which will contain the shape.
      * @param aFunctor a functor defining the shape.
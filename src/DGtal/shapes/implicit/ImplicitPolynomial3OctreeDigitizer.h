@@ -0,0 +1,366 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImplicitPolynomial3OctreeDigitizer.h
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module ImplicitPolynomial3OctreeDigitizer.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImplicitPolynomial3OctreeDigitizer_RECURSES)
+#error Recursive header files inclusion detected in ImplicitPolynomial3OctreeDigitizer.h
+#else // defined(ImplicitPolynomial3OctreeDigitizer_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImplicitPolynomial3OctreeDigitizer_RECURSES
+
+#if !defined ImplicitPolynomial3OctreeDigitizer_h
+/** Prevents repeated inclusion of headers. */
+#define ImplicitPolynomial3OctreeDigitizer_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/RegularPointEmbedder.h"
+#include "DGtal/math/MPolynomial.h"
+#include "DGtal/math/CompiledMPolynomial3.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImplicitPolynomial3OctreeDigitizer
+  /**
+     Description of template class 'ImplicitPolynomial3OctreeDigitizer' <p>
+     \brief Aim: Computes the boundary of the Gauss digitization of
+     the shape { x, P(x) <= 0 } for some 3-polynomial P, i.e. the
+     digitization of an ImplicitPolynomial3Shape, by visiting only the
+     parts of the domain close to the surface P(x) = 0.
+
+     The domain is recursively split into octants. Each block of
+     digital points is classified by evaluating P with interval
+     arithmetic on the Euclidean box containing the block and its
+     6-neighbors: if P is bounded away from zero there, the block
+     contains no boundary point and is discarded. P is only evaluated
+     at the points of the leaf blocks that may intersect the zero level
+     set, so that the cost is proportional to the area of the surface
+     instead of the volume of the domain. Leaf blocks are processed in
+     parallel with OpenMP, and their points are evaluated row by row
+     with CompiledMPolynomial3::evaluateRow.
+
+     The digitization is the same as the one of a GaussDigitizer
+     attached to an ImplicitPolynomial3Shape initialized with the same
+     bounds and grid steps, points outside the domain being considered
+     as outside the shape. The object is also a model of
+     CDigitalBoundedShape and CDigitalOrientedShape, so that it can be
+     used by Surfaces::findABel and Surfaces::trackBoundary.
+
+     @code
+     typedef ImplicitPolynomial3OctreeDigitizer<Z3i::Space> Digitizer;
+     Digitizer digitizer;
+     digitizer.attach( P );
+     digitizer.init( RealPoint( -2, -2, -2 ), RealPoint( 2, 2, 2 ), 0.001 );
+     KSpace K;
+     K.init( digitizer.getLowerBound(), digitizer.getUpperBound(), true );
+     std::vector<SCell> surfels;
+     digitizer.computeBoundarySurfels( K, std::back_inserter( surfels ) );
+     @endcode
+
+     @tparam TSpace the type of digital Space, of dimension 3.
+   */
+  template <typename TSpace>
+  class ImplicitPolynomial3OctreeDigitizer
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef ImplicitPolynomial3OctreeDigitizer<TSpace> Self;
+    typedef TSpace Space;
+    typedef typename Space::Integer Integer;
+    typedef typename Space::Point Point;
+    typedef typename Space::Vector Vector;
+    typedef typename Space::RealPoint RealPoint;
+    typedef typename Space::RealVector RealVector;
+    typedef typename RealPoint::Coordinate Ring;
+    typedef MPolynomial< 3, Ring > Polynomial3;
+    typedef CompiledMPolynomial3< Ring > CompiledPolynomial3;
+    typedef HyperRectDomain<Space> Domain;
+    typedef typename Domain::Size Size;
+    typedef RegularPointEmbedder<Space> PointEmbedder;
+
+    BOOST_STATIC_ASSERT(( Space::dimension == 3 ));
+
+    /**
+     * Destructor.
+     */
+    ~ImplicitPolynomial3OctreeDigitizer();
+
+    /**
+     * Constructor. The object is not valid.
+     */
+    ImplicitPolynomial3OctreeDigitizer();
+
+    /**
+       @param poly the digitizer now references the given polynomial,
+       and evaluates it at points through its compiled form.
+    */
+    void attach( const Polynomial3 & poly );
+
+    /**
+       Initializes the digital bounds of the digitizer so as to cover
+       at least the space specified by [xLow] and [xUp], as
+       GaussDigitizer::init.
+
+       @param xLow Euclidean lower bound for the digitizer.
+       @param xUp Euclidean upper bound for the digitizer.
+       @param gridStep the grid step, identical in every direction.
+    */
+    void init( const RealPoint & xLow, const RealPoint & xUp,
+               typename RealVector::Component gridStep );
+
+    /**
+       Initializes the digital bounds of the digitizer so as to cover
+       at least the space specified by [xLow] and [xUp], as
+       GaussDigitizer::init.
+
+       @param xLow Euclidean lower bound for the digitizer.
+       @param xUp Euclidean upper bound for the digitizer.
+       @param gridSteps the grid steps in each direction.
+    */
+    void init( const RealPoint & xLow, const RealPoint & xUp,
+               const RealVector & gridSteps );
+
+    /**
+       Sets the maximal number of points along each axis of the leaf
+       blocks, at which the subdivision stops (default 4).
+
+       @param aLeafSize any positive number.
+    */
+    void setLeafSize( Size aLeafSize );
+
+    /**
+       @return the maximal number of points along each axis of the leaf blocks.
+    */
+    Size leafSize() const;
+
+    /**
+       @return the associated point embedder.
+    */
+    const PointEmbedder & pointEmbedder() const;
+
+    /**
+       @return the domain chosen for the digitizer.
+       @see init
+    */
+    Domain getDomain() const;
+
+    /**
+       @return the lowest admissible digital point.
+    */
+    const Point & getLowerBound() const;
+
+    /**
+       @return the highest admissible digital point.
+    */
+    const Point & getUpperBound() const;
+
+    /**
+     * Map a digital point to its corresponding point in the Euclidean
+     * space.
+     *
+     * @param p any digital point in the digital space.
+     * @return its embedding in the Euclidean space.
+     */
+    RealPoint embed( const Point & p ) const;
+
+    /**
+     * @param p a digital point
+     * @return INSIDE if the polynomial value at the embedding of @a p
+     * is negative, ON if it is zero, OUTSIDE otherwise.
+     */
+    Orientation orientation( const Point & p ) const;
+
+    /**
+     * @param p any digital point.
+     * @return 'true' if the point is inside or on the shape.
+     */
+    bool operator()( const Point & p ) const;
+
+    /**
+     * Inserts in @a aSet the inner boundary of the digitized shape,
+     * i.e. its points having a 6-neighbor outside the shape or
+     * outside the domain.
+     *
+     * @tparam TDigitalSet a model of CDigitalSet on getDomain().
+     * @param[in,out] aSet the set where points are inserted.
+     */
+    template <typename TDigitalSet>
+    void computeBoundary( TDigitalSet & aSet ) const;
+
+    /**
+     * Outputs the boundary surfels of the digitized shape, each one
+     * separating a point of the shape from a 6-neighbor outside the
+     * shape or outside the domain, with the orientation of
+     * Surfaces::sMakeBoundary.
+     *
+     * @tparam KSpace a model of CCellularGridSpaceND of dimension 3,
+     * initialized on the bounds of the digitizer and closed.
+     * @tparam OutputIterator an output iterator on KSpace::SCell.
+     * @param K the cellular grid space.
+     * @param out the output iterator where surfels are written.
+     * @return the output iterator after the last surfel.
+     */
+    template <typename KSpace, typename OutputIterator>
+    OutputIterator computeBoundarySurfels( const KSpace & K, OutputIterator out ) const;
+
+    /**
+       @return the number of blocks classified by interval arithmetic
+       during the last boundary computation.
+    */
+    Size nbBlocks() const;
+
+    /**
+       @return the number of evaluations of the polynomial at digital
+       points during the last boundary computation.
+    */
+    Size nbEvaluations() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// The referenced polynomial or 0 if not initialized.
+    const Polynomial3* myPolynomial;
+
+    /// The compiled polynomial, for point evaluations.
+    CompiledPolynomial3 myCompiledPolynomial;
+
+    /// The embedder
+    PointEmbedder myPointEmbedder;
+
+    /// Digital lowest point
+    Point myLowerPoint;
+
+    /// Digital uppest point
+    Point myUpperPoint;
+
+    /// Maximal number of points along each axis of the leaf blocks.
+    Size myLeafSize;
+
+    /// Number of blocks classified during the last computation.
+    mutable Size myNbBlocks;
+
+    /// Number of point evaluations during the last computation.
+    mutable Size myNbEvaluations;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// A block of digital points, given by its bounds.
+    struct Block
+    {
+      Point lower;
+      Point upper;
+    };
+
+    /// A boundary face, between a point of the shape and its
+    /// neighbor along axis dim, in the positive direction if up.
+    struct BoundaryFace
+    {
+      Point point;
+      Dimension dim;
+      bool up;
+    };
+
+    /**
+       Classifies a block and its neighbors, then either discards it,
+       appends it to the leaves or subdivides it.
+
+       @param lower the lower bound of the block.
+       @param upper the upper bound of the block.
+       @param[in,out] leaves the leaf blocks that may contain boundary points.
+    */
+    void subdivide( const Point & lower, const Point & upper,
+                    std::vector<Block> & leaves ) const;
+
+    /**
+       Evaluates the polynomial at the points of a leaf block and at
+       their 6-neighbors, and writes the boundary faces of the block.
+
+       @param aBlock any leaf block.
+       @param[out] faces the boundary faces of the points of the block.
+       @return the number of evaluations of the polynomial.
+    */
+    Size computeLeafFaces( const Block & aBlock,
+                           std::vector<BoundaryFace> & faces ) const;
+
+    /**
+       Computes the boundary faces of the whole domain.
+
+       @param[out] faces the boundary faces, block by block.
+    */
+    void computeFaces( std::vector< std::vector<BoundaryFace> > & faces ) const;
+
+  }; // end of class ImplicitPolynomial3OctreeDigitizer
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImplicitPolynomial3OctreeDigitizer'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImplicitPolynomial3OctreeDigitizer' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ImplicitPolynomial3OctreeDigitizer<TSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/shapes/implicit/ImplicitPolynomial3OctreeDigitizer.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImplicitPolynomial3OctreeDigitizer_h
+
+#undef ImplicitPolynomial3OctreeDigitizer_RECURSES
+#endif // else defined(ImplicitPolynomial3OctreeDigitizer_RECURSES)
@@ -46,6 +46,7 @@
 #include "DGtal/base/CPredicate.h"
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/math/MPolynomial.h"
+#include "DGtal/math/CompiledMPolynomial3.h"
 #include "DGtal/shapes/implicit/CImplicitFunction.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -58,6 +59,10 @@ namespace DGtal
    * \brief Aim: model of CEuclideanOrientedShape concepts to create a
    * shape from a polynomial.
    *
+   * The polynomial and the derivatives used by the evaluations are
+   * compiled at initialization (see CompiledMPolynomial3), so that
+   * the values, gradients and curvatures are computed in Horner form.
+   *
    * Model of CImplicitFunction
    *
    * @tparam TSpace the Digital space definition.
@@ -75,6 +80,7 @@ namespace DGtal
     typedef typename RealPoint::Coordinate Ring;
     typedef typename Space::Integer Integer;
     typedef MPolynomial< 3, Ring > Polynomial3;
+    typedef CompiledMPolynomial3< Ring > CompiledPolynomial3;
     typedef Ring Value;
 
     BOOST_STATIC_ASSERT(( Space::dimension == 3 ));
@@ -110,6 +116,12 @@ namespace DGtal
     // ----------------------- Interface --------------------------------------
   public:
 
+    /**
+       @return the polynomial compiled for fast evaluation, for
+       instance to evaluate it on batches or rows of points.
+    */
+    const CompiledPolynomial3 & compiledPolynomial() const;
+
     /**
        @param aPoint any point in the Euclidean space.
        @return the value of the polynomial at \a aPoint.
@@ -239,6 +251,20 @@ namespace DGtal
     Polynomial3 myUpPolynome;
     Polynomial3 myLowPolynome;
 
+    // Compiled forms of the polynomials used by the evaluations
+    CompiledPolynomial3 myCompiledPolynomial;
+    CompiledPolynomial3 myCompiledFx;
+    CompiledPolynomial3 myCompiledFy;
+    CompiledPolynomial3 myCompiledFz;
+    CompiledPolynomial3 myCompiledFxx;
+    CompiledPolynomial3 myCompiledFxy;
+    CompiledPolynomial3 myCompiledFxz;
+    CompiledPolynomial3 myCompiledFyy;
+    CompiledPolynomial3 myCompiledFyz;
+    CompiledPolynomial3 myCompiledFzz;
+    CompiledPolynomial3 myCompiledUpPolynome;
+    CompiledPolynomial3 myCompiledLowPolynome;
+
 
     // ------------------------- Hidden services ------------------------------
   protected:
@@ -212,11 +212,11 @@ namespace DGtal
     bool isInside( const Surfel & s ) const;
 
     /// @return an iterator pointing on the first surfel of the digital surface
-    /// (unspecified order).
+    /// (surfels are sorted by increasing order).
     SurfelConstIterator begin() const;
 
     /// @return an iterator after the last surfel of the digital surface
-    /// (unspecified order).
+    /// (surfels are sorted by increasing order).
     SurfelConstIterator end() const;
 
     /// @return the number of surfels of this digital surface.
@@ -0,0 +1,410 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FrozenDigitalSurface.h
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module FrozenDigitalSurface.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(FrozenDigitalSurface_RECURSES)
+#error Recursive header files inclusion detected in FrozenDigitalSurface.h
+#else // defined(FrozenDigitalSurface_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FrozenDigitalSurface_RECURSES
+
+#if !defined FrozenDigitalSurface_h
+/** Prevents repeated inclusion of headers. */
+#define FrozenDigitalSurface_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <set>
+#include <map>
+#include <utility>
+#include <boost/iterator/counting_iterator.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/DigitalSurface.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FrozenDigitalSurface
+  /**
+     Description of template class 'FrozenDigitalSurface' <p> \brief
+     Aim: An immutable indexed copy of a DigitalSurface, where the
+     adjacency graph and the faces (umbrellas) are precomputed and
+     stored in compressed sparse row (CSR) arrays.
+
+     The surfels are numbered contiguously from 0 to size()-1 (by
+     increasing order of surfels). The arcs leaving the vertex \a v
+     are numbered contiguously in [firstArc(v),lastArc(v)), so that
+     neighbors, heads, tails and opposite arcs are obtained in
+     constant time. The faces are numbered in increasing order of
+     DigitalSurface::Face, and both the vertices around each face and
+     the faces around each vertex are stored in CSR arrays.
+
+     Vertices are indices, hence any data associated to vertices,
+     arcs or faces can be stored in a std::vector indexed by vertex,
+     arc or face (see IndexedMap).
+
+     The DigitalSurface is tracked only once, when the surface is
+     frozen. This is done in parallel (each thread working on its own
+     copy of the DigitalSurface) if DGtal has been built with OpenMP
+     support (WITH_OPENMP flag set to "true"): the tracker of the
+     container must then be thread-safe when used from different
+     copies. The result does not depend on the number of threads.
+
+     It is a model of concepts::CUndirectedSimpleGraph.
+
+     @code
+     typedef DigitalSetBoundary<KSpace,DigitalSet> Container;
+     typedef FrozenDigitalSurface<Container> Frozen;
+     DigitalSurface<Container> surface( ... );
+     Frozen frozen( surface );
+     Frozen::IndexedMap<double>::Type sum( frozen.size(), 0.0 );
+     for ( Frozen::Index v = 0; v < frozen.size(); ++v )
+       for ( Frozen::Index a = frozen.firstArc( v ); a != frozen.lastArc( v ); ++a )
+         sum[ v ] += values[ frozen.head( a ) ];
+     @endcode
+
+     @tparam TDigitalSurfaceContainer any model of
+     concepts::CDigitalSurfaceContainer.
+   */
+  template <typename TDigitalSurfaceContainer>
+  class FrozenDigitalSurface
+  {
+  public:
+    typedef TDigitalSurfaceContainer DigitalSurfaceContainer;
+    typedef DigitalSurface<DigitalSurfaceContainer> Surface;
+    typedef FrozenDigitalSurface<DigitalSurfaceContainer> Self;
+    typedef typename Surface::KSpace KSpace;
+    typedef typename Surface::SCell SCell;
+    typedef typename Surface::Surfel Surfel;
+    typedef typename Surface::Arc SurfaceArc;
+    typedef typename Surface::Face SurfaceFace;
+
+    /// Type of index of vertices, arcs and faces.
+    typedef std::size_t Index;
+    /// Type of the arrays of indices.
+    typedef std::vector<Index> IndexContainer;
+    /// Range [first,last) of indices, read from a CSR array.
+    typedef std::pair< typename IndexContainer::const_iterator,
+                       typename IndexContainer::const_iterator > IndexRange;
+
+    // ----------------------- CUndirectedSimpleGraph --------------------------
+    /// The vertices of the graph are the indices of the surfels.
+    typedef Index Vertex;
+    /// Type for counting vertices.
+    typedef typename KSpace::Size Size;
+    /// Defines how to represent a set of vertex.
+    typedef std::set<Vertex> VertexSet;
+    /// Template rebinding for defining the type that is a mapping
+    /// Vertex -> Value.
+    template <typename Value> struct VertexMap {
+      typedef std::map<Vertex,Value> Type;
+    };
+    /// Type of the data associated to each vertex, arc or face,
+    /// which is a plain array indexed by vertex, arc or face.
+    template <typename Value> struct IndexedMap {
+      typedef std::vector<Value> Type;
+    };
+    /// Iterator on the vertices.
+    typedef boost::counting_iterator<Index> ConstIterator;
+    /// An edge is an unordered pair of vertices, the smallest one first.
+    typedef std::pair<Vertex,Vertex> Edge;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Constructor. The surface is empty.
+    */
+    FrozenDigitalSurface();
+
+    /**
+       Constructor from digital surface.
+       @param surface any digital surface.
+    */
+    FrozenDigitalSurface( const Surface & surface );
+
+    /**
+       Freezes the given digital surface, replacing the previous one:
+       numbers its surfels and precomputes its arcs and faces.
+
+       @param surface any digital surface.
+    */
+    void init( const Surface & surface );
+
+    // ----------------------- Vertices ---------------------------------------
+  public:
+
+    /// @return the number of vertices (surfels) of the surface.
+    Size size() const;
+
+    /// @return the number of vertices (surfels) of the surface.
+    Index nbVertices() const;
+
+    /// @return an iterator on the first vertex.
+    ConstIterator begin() const;
+
+    /// @return an iterator after the last vertex.
+    ConstIterator end() const;
+
+    /**
+       @param v any vertex.
+       @return the surfel corresponding to vertex \a v.
+    */
+    const Surfel & surfel( Vertex v ) const;
+
+    /// @return the surfels, sorted, such that surfels()[ v ] is the surfel of vertex \a v.
+    const std::vector<Surfel> & surfels() const;
+
+    /**
+       @param s any surfel.
+       @return the vertex of surfel \a s, or size() if \a s is not
+       a surfel of the surface (logarithmic time).
+    */
+    Index index( const Surfel & s ) const;
+
+    /**
+       @param v any vertex.
+       @return the number of neighbors of \a v.
+    */
+    Size degree( const Vertex & v ) const;
+
+    /**
+       @return the maximal number of neighbors of a vertex.
+    */
+    Size bestCapacity() const;
+
+    /**
+       Writes the neighbors of [v] in the output iterator.
+
+       @tparam OutputIterator the type for the output iterator
+       (e.g. back_insert_iterator<std::vector<Vertex> >).
+
+       @param[in,out] it any output iterator on Vertex (*it++ should
+       be allowed), which specifies where neighbors are written.
+
+       @param[in] v any vertex of this graph.
+    */
+    template <typename OutputIterator>
+    void writeNeighbors( OutputIterator & it, const Vertex & v ) const;
+
+    /**
+       Writes the neighbors of [v], verifying the predicate [pred] in
+       the output iterator.
+
+       @tparam OutputIterator the type for the output iterator
+       (e.g. back_insert_iterator<std::vector<Vertex> >).
+
+       @tparam VertexPredicate any type of predicate taking a Vertex as input.
+
+       @param[in,out] it any output iterator on Vertex (*it++ should
+       be allowed), which specifies where neighbors are written.
+
+       @param[in] v any vertex of this graph.
+
+       @param[in] pred the predicate for selecting neighbors.
+    */
+    template <typename OutputIterator, typename VertexPredicate>
+    void writeNeighbors( OutputIterator & it, const Vertex & v,
+                         const VertexPredicate & pred ) const;
+
+    /**
+       @param v any vertex.
+       @return the range of the neighbors of \a v, in the order of
+       DigitalSurface::outArcs.
+    */
+    IndexRange neighbors( const Vertex & v ) const;
+
+    // ----------------------- Arcs -------------------------------------------
+  public:
+
+    /// @return the number of arcs (twice the number of edges).
+    Index nbArcs() const;
+
+    /**
+       @param v any vertex.
+       @return the first arc leaving \a v.
+    */
+    Index firstArc( const Vertex & v ) const;
+
+    /**
+       @param v any vertex.
+       @return the arc after the last arc leaving \a v.
+    */
+    Index lastArc( const Vertex & v ) const;
+
+    /**
+       @param a any arc.
+       @return the vertex from which \a a leaves.
+    */
+    Vertex tail( Index a ) const;
+
+    /**
+       @param a any arc.
+       @return the vertex toward which \a a points.
+    */
+    Vertex head( Index a ) const;
+
+    /**
+       @param a any arc.
+       @return the arc with the same vertices but the reverse direction.
+    */
+    Index opposite( Index a ) const;
+
+    /**
+       @param a any arc.
+       @return the corresponding arc of the digital surface.
+    */
+    SurfaceArc arc( Index a ) const;
+
+    // ----------------------- Faces ------------------------------------------
+  public:
+
+    /// @return the number of faces (umbrellas).
+    Index nbFaces() const;
+
+    /**
+       @param f any face.
+       @return the corresponding face of the digital surface.
+    */
+    const SurfaceFace & face( Index f ) const;
+
+    /**
+       @param f any face.
+       @return 'true' if the face \a f is closed.
+    */
+    bool isClosed( Index f ) const;
+
+    /**
+       @param f any face.
+       @return the vertices around the face \a f, in the order of
+       DigitalSurface::verticesAroundFace.
+    */
+    IndexRange verticesAroundFace( Index f ) const;
+
+    /**
+       @param v any vertex.
+       @return the faces around the vertex \a v (each one only once),
+       in the order of their first occurrence in
+       DigitalSurface::facesAroundVertex.
+    */
+    IndexRange facesAroundVertex( const Vertex & v ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// the surfels, sorted.
+    std::vector<Surfel> mySurfels;
+    /// the arcs leaving the v-th vertex are in [myArcOffsets[v],myArcOffsets[v+1]).
+    IndexContainer myArcOffsets;
+    /// the tail of each arc.
+    IndexContainer myTails;
+    /// the head of each arc.
+    IndexContainer myHeads;
+    /// the opposite of each arc.
+    IndexContainer myOpposites;
+    /// the direction toward the head surfel of each arc.
+    std::vector<Dimension> myArcDirections;
+    /// the orientation toward the head surfel of each arc (not a
+    /// std::vector<bool>, which cannot be written concurrently).
+    std::vector<unsigned char> myArcOrientations;
+    /// the maximal degree.
+    Size myMaxDegree;
+    /// the faces, sorted.
+    std::vector<SurfaceFace> myFaces;
+    /// the vertices of the f-th face are in [myFaceOffsets[f],myFaceOffsets[f+1]).
+    IndexContainer myFaceOffsets;
+    /// the vertices around each face.
+    IndexContainer myFaceVertices;
+    /// the faces of the v-th vertex are in [myVertexFaceOffsets[v],myVertexFaceOffsets[v+1]).
+    IndexContainer myVertexFaceOffsets;
+    /// the faces around each vertex.
+    IndexContainer myVertexFaces;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       @param surface the digital surface.
+       @param v any vertex.
+       @param[out] faces the faces around the vertex \a v, each one only once.
+    */
+    static void uniqueFacesAroundVertex( const Surface & surface, const Surfel & v,
+                                         std::vector<SurfaceFace> & faces );
+
+    /**
+       @param f any face of the surface.
+       @return its index.
+    */
+    Index faceIndex( const SurfaceFace & f ) const;
+
+  }; // end of class FrozenDigitalSurface
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FrozenDigitalSurface'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FrozenDigitalSurface' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDigitalSurfaceContainer>
+  std::ostream&
+  operator<< ( std::ostream & out, const FrozenDigitalSurface<TDigitalSurfaceContainer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/FrozenDigitalSurface.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FrozenDigitalSurface_h
+
+#undef FrozenDigitalSurface_RECURSES
+#endif // else defined(FrozenDigitalSurface_RECURSES)
@@ -0,0 +1,361 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file IndexedDigitalSurface.h
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module IndexedDigitalSurface.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(IndexedDigitalSurface_RECURSES)
+#error Recursive header files inclusion detected in IndexedDigitalSurface.h
+#else // defined(IndexedDigitalSurface_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define IndexedDigitalSurface_RECURSES
+
+#if !defined IndexedDigitalSurface_h
+/** Prevents repeated inclusion of headers. */
+#define IndexedDigitalSurface_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/CCellEmbedder.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/FrozenDigitalSurface.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class IndexedDigitalSurface
+  /**
+     Description of template class 'IndexedDigitalSurface' <p> \brief
+     Aim: A half-edge representation of a closed DigitalSurface,
+     where vertices (surfels), arcs and faces (umbrellas) are integer
+     indices.
+
+     Each arc (half-edge) \a a knows its head, its opposite arc, the
+     next arc along its face and its face. Each vertex knows one arc
+     leaving it and each face knows one of its arcs. Turning around a
+     face or around a vertex is then done in constant time per step,
+     without tracking the surface nor computing umbrellas:
+
+     - the arcs of the face of \a a are \a a, next( a ), next( next( a ) ), ...
+     - the arcs leaving tail( a ) are \a a, next( opposite( a ) ), ...
+
+     The structure is obtained from a FrozenDigitalSurface (which is
+     computed in parallel if DGtal has been built with OpenMP
+     support), the arcs of each face being oriented as the vertices
+     given by DigitalSurface::verticesAroundFace. Vertices, arcs and
+     faces have the same indices as in the FrozenDigitalSurface.
+
+     The digital surface must be closed: every umbrella is closed and
+     every arc lies on exactly one face. Otherwise, init() fails.
+
+     @code
+     typedef DigitalSetBoundary<KSpace,DigitalSet> Container;
+     IndexedDigitalSurface<Container> mesh;
+     if ( mesh.init( surface ) )
+       {
+         std::ofstream out( "surface.off" );
+         mesh.exportEmbeddedSurfaceAs3DOFF( out, CanonicCellEmbedder<KSpace>( K ) );
+       }
+     @endcode
+
+     @tparam TDigitalSurfaceContainer any model of
+     concepts::CDigitalSurfaceContainer.
+   */
+  template <typename TDigitalSurfaceContainer>
+  class IndexedDigitalSurface
+  {
+  public:
+    typedef TDigitalSurfaceContainer DigitalSurfaceContainer;
+    typedef DigitalSurface<DigitalSurfaceContainer> Surface;
+    typedef FrozenDigitalSurface<DigitalSurfaceContainer> Frozen;
+    typedef IndexedDigitalSurface<DigitalSurfaceContainer> Self;
+    typedef typename Surface::KSpace KSpace;
+    typedef typename Surface::SCell SCell;
+    typedef typename Surface::Surfel Surfel;
+    typedef typename KSpace::Point Point;
+    typedef typename KSpace::Size Size;
+
+    /// Type of index of vertices, arcs and faces.
+    typedef std::size_t Index;
+    /// A vertex is the index of a surfel.
+    typedef Index Vertex;
+    /// An arc (half-edge) is an index.
+    typedef Index Arc;
+    /// A face (umbrella) is an index.
+    typedef Index Face;
+    /// The range of vertices is defined as a vector.
+    typedef std::vector<Vertex> VertexRange;
+    /// The range of arcs is defined as a vector.
+    typedef std::vector<Arc> ArcRange;
+    /// The range of faces is defined as a vector.
+    typedef std::vector<Face> FaceRange;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Constructor. The surface is empty.
+    */
+    IndexedDigitalSurface();
+
+    /**
+       Builds the half-edge representation of the given digital
+       surface, replacing the previous one.
+
+       @param surface any closed digital surface.
+       @return 'true' if the surface is closed, 'false' otherwise (the
+       object is then empty).
+    */
+    bool init( const Surface & surface );
+
+    /// @return the cellular space in which lives the surface.
+    const KSpace & space() const;
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+
+    /// @return the number of vertices (surfels).
+    Index nbVertices() const;
+
+    /// @return the number of arcs (half-edges).
+    Index nbArcs() const;
+
+    /// @return the number of edges (pairs of opposite arcs).
+    Index nbEdges() const;
+
+    /// @return the number of faces (umbrellas).
+    Index nbFaces() const;
+
+    /**
+       @param v any vertex.
+       @return its surfel.
+    */
+    const Surfel & surfel( Vertex v ) const;
+
+    /// @return the surfels, sorted, such that surfels()[ v ] is the surfel of vertex \a v.
+    const std::vector<Surfel> & surfels() const;
+
+    /**
+       @param s any surfel.
+       @return the vertex of surfel \a s, or nbVertices() if \a s is
+       not a surfel of the surface (logarithmic time).
+    */
+    Vertex index( const Surfel & s ) const;
+
+    /**
+       @param a any arc.
+       @return the vertex toward which \a a points.
+    */
+    Vertex head( Arc a ) const;
+
+    /**
+       @param a any arc.
+       @return the vertex from which \a a leaves.
+    */
+    Vertex tail( Arc a ) const;
+
+    /**
+       @param a any arc.
+       @return the arc with the same vertices but the reverse direction.
+    */
+    Arc opposite( Arc a ) const;
+
+    /**
+       @param a any arc.
+       @return the arc following \a a along its face.
+    */
+    Arc next( Arc a ) const;
+
+    /**
+       @param a any arc.
+       @return the arc preceding \a a along its face (linear in the
+       number of vertices of the face).
+    */
+    Arc previous( Arc a ) const;
+
+    /**
+       @param a any arc.
+       @return the face lying along \a a.
+    */
+    Face faceOfArc( Arc a ) const;
+
+    /**
+       @param v any vertex.
+       @return one arc leaving \a v.
+    */
+    Arc outArc( Vertex v ) const;
+
+    /**
+       @param f any face.
+       @return one arc of \a f, which leaves the first vertex of
+       verticesAroundFace( f ).
+    */
+    Arc faceArc( Face f ) const;
+
+    /**
+       @param v any vertex.
+       @return the number of neighbors of \a v.
+    */
+    Size degree( Vertex v ) const;
+
+    /**
+       @param v any vertex.
+       @return the arcs leaving \a v, turning around \a v.
+    */
+    ArcRange outArcs( Vertex v ) const;
+
+    /**
+       @param v any vertex.
+       @return the faces around \a v, turning around \a v.
+    */
+    FaceRange facesAroundVertex( Vertex v ) const;
+
+    /**
+       @param f any face.
+       @return the arcs of \a f, in order.
+    */
+    ArcRange arcsAroundFace( Face f ) const;
+
+    /**
+       @param f any face.
+       @return the vertices of \a f, in the order of
+       DigitalSurface::verticesAroundFace.
+    */
+    VertexRange verticesAroundFace( Face f ) const;
+
+    // ----------------------- Export -----------------------------------------
+  public:
+
+    /**
+       Writes the surface on an output stream in OFF file format
+       (vertices are the Khalimsky coordinates of the surfels). The
+       output is the same as DigitalSurface::exportSurfaceAs3DOFF
+       when the container enumerates its surfels by increasing order.
+
+       @param out the output stream where the object is written.
+     */
+    void exportSurfaceAs3DOFF ( std::ostream & out ) const;
+
+    /**
+       Writes the surface on an output stream in OFF file format.
+       Cells are embedded by [cembedder]. Normals are not computed.
+
+       @param out the output stream where the object is written.
+       @param cembedder any embedder of cellular grid elements.
+
+       @tparam CellEmbedder any model of CCellEmbedder.
+     */
+    template <typename CellEmbedder>
+    void exportEmbeddedSurfaceAs3DOFF ( std::ostream & out,
+                                        const CellEmbedder & cembedder ) const;
+
+    /**
+       Adds the vertices and the faces of the surface to a mesh, for
+       instance in order to export it with MeshWriter.
+
+       @param[in,out] mesh any Mesh, whose points can be built from
+       the points given by the embedder.
+       @param cembedder any embedder of cellular grid elements.
+
+       @tparam TMesh the type of the mesh (e.g. Mesh<Z3i::RealPoint>).
+       @tparam CellEmbedder any model of CCellEmbedder.
+     */
+    template <typename TMesh, typename CellEmbedder>
+    void addToMesh ( TMesh & mesh, const CellEmbedder & cembedder ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// the cellular space.
+    KSpace myKSpace;
+    /// the surfels, sorted.
+    std::vector<Surfel> mySurfels;
+    /// the head of each arc.
+    std::vector<Index> myHeads;
+    /// the opposite of each arc.
+    std::vector<Index> myOpposites;
+    /// the next arc along the face of each arc.
+    std::vector<Index> myNexts;
+    /// the face of each arc.
+    std::vector<Index> myArcFaces;
+    /// one arc leaving each vertex.
+    std::vector<Index> myVertexArcs;
+    /// one arc of each face.
+    std::vector<Index> myFaceArcs;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Empties the surface.
+    void clear();
+
+  }; // end of class IndexedDigitalSurface
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'IndexedDigitalSurface'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'IndexedDigitalSurface' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDigitalSurfaceContainer>
+  std::ostream&
+  operator<< ( std::ostream & out, const IndexedDigitalSurface<TDigitalSurfaceContainer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/IndexedDigitalSurface.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined IndexedDigitalSurface_h
+
+#undef IndexedDigitalSurface_RECURSES
+#endif // else defined(IndexedDigitalSurface_RECURSES)
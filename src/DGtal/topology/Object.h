@@ -55,6 +55,7 @@
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
+#include "DGtal/kernel/sets/DigitalSetByBitVector.h"
 #include "DGtal/topology/Topology.h"
 #include <boost/graph/graph_traits.hpp>
 #include <boost/graph/properties.hpp>
@@ -402,6 +403,9 @@ namespace DGtal
      * which is lambda()-adjacent with some point of the background).
      *
      * NB : the background adjacency should be a symmetric relation.
+     *
+     * NB : when the point set is a DigitalSetByBitVector, the border
+     * is computed row by row with DigitalSetByBitVector::assignFromBorder.
      */
     Object border() const;
 
@@ -465,6 +469,11 @@ objects[ 0 ].writeComponents( it ); // it points in same container as this.
      * @return the connectedness of this object. Either CONNECTED or
      * DISCONNECTED.
      *
+     * NB : when the point set is a DigitalSetByBitVector, its
+     * components are counted by union-find with
+     * DigitalSetByBitVector::computeNbComponents instead of a
+     * breadth-first traversal.
+     *
      * @see connectedness
      */
     Connectedness computeConnectedness() const;
@@ -641,6 +650,42 @@ objects[ 0 ].writeComponents( it ); // it points in same container as this.
 
     // ------------------------- Protected Datas ------------------------------
   private:
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param aSet the point set of this object.
+     * @return the border of this object, by looking at the
+     * neighbors of each point.
+     */
+    template <typename TAnyDigitalSet>
+    Object computeBorder( const TAnyDigitalSet & aSet ) const;
+
+    /**
+     * @param aSet the point set of this object.
+     * @return the border of this object, computed on whole rows of
+     * the bit array.
+     */
+    template <typename TDomain>
+    Object computeBorder( const DigitalSetByBitVector<TDomain> & aSet ) const;
+
+    /**
+     * @param aSet the point set of this object.
+     * @return the connectedness of this object, by a breadth-first
+     * traversal from its first point.
+     */
+    template <typename TAnyDigitalSet>
+    Connectedness computeConnectedness( const TAnyDigitalSet & aSet ) const;
+
+    /**
+     * @param aSet the point set of this object.
+     * @return the connectedness of this object, by union-find on the
+     * runs of the bit array.
+     */
+    template <typename TDomain>
+    Connectedness computeConnectedness
+    ( const DigitalSetByBitVector<TDomain> & aSet ) const;
+
     // ------------------------- Private Datas --------------------------------
   private:
 
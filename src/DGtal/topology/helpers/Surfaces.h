@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Exceptions.h"
 #include "DGtal/topology/SurfelAdjacency.h"
@@ -773,6 +774,134 @@ namespace DGtal
                          const PointPredicate & pp,
                          const Point & aLowerBound, 
                          const Point & aUpperBound  );
+
+    /**
+       Creates a set of unsigned surfels whose elements represents all the
+       boundary components of a digital shape described by the predicate
+       [pp]. Same result as uMakeBoundary, but the domain is split into
+       slabs along the last axis, which are processed in parallel if
+       DGtal has been built with OpenMP support (WITH_OPENMP flag set to
+       "true"). The surfels are inserted in increasing order.
+       
+       @tparam CellSet a model of a set of Cell (e.g., std::set<Cell>),
+       with an insert( hint, value ) method.
+       @tparam PointPredicate a model of concepts::CPointPredicate
+       describing the inside of a digital shape, whose evaluation is
+       thread-safe.
+       
+       @param aBoundary (modified) a set of cells (which are all surfels),
+       the boundary component of [aSpelSet].
+       
+       @param aKSpace any space.
+       @param pp an instance of a model of concepts::CPointPredicate, for
+       instance a SetPredicate for a digital set representing a shape.
+
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the extracted boundary.
+    */
+    template <typename CellSet, typename PointPredicate >
+    static 
+    void uParallelMakeBoundary( CellSet & aBoundary,
+                                const KSpace & aKSpace,
+                                const PointPredicate & pp,
+                                const Point & aLowerBound, 
+                                const Point & aUpperBound  );
+
+    /**
+       Creates a set of signed surfels whose elements represents all the
+       boundary components of a digital shape described by the predicate
+       [pp]. Same result as sMakeBoundary, but the domain is split into
+       slabs along the last axis, which are processed in parallel if
+       DGtal has been built with OpenMP support (WITH_OPENMP flag set to
+       "true"). The surfels are inserted in increasing order.
+       
+       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>),
+       with an insert( hint, value ) method.
+       @tparam PointPredicate a model of concepts::CPointPredicate
+       describing the inside of a digital shape, whose evaluation is
+       thread-safe.
+       
+       @param aBoundary (modified) a set of cells (which are all surfels),
+       the boundary component of [aSpelSet].
+       
+       @param aKSpace any space.
+       @param pp an instance of a model of concepts::CPointPredicate, for
+       instance a SetPredicate for a digital set representing a shape.
+
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the extracted boundary.
+    */
+    template <typename SCellSet, typename PointPredicate >
+    static 
+    void sParallelMakeBoundary( SCellSet & aBoundary,
+                                const KSpace & aKSpace,
+                                const PointPredicate & pp,
+                                const Point & aLowerBound, 
+                                const Point & aUpperBound  );
+
+    /**
+       Writes on the output iterator @a out_it the unsigned surfels
+       of uMakeBoundary, in increasing order (the order of
+       std::set<Cell>). The surfels of each slab of the domain along
+       the last axis are extracted and sorted in parallel if DGtal
+       has been built with OpenMP support, then merged.
+       
+       @tparam OutputIterator any output iterator (like
+       std::back_insert_iterator< std::vector<Cell> >).
+
+       @tparam PointPredicate a model of concepts::CPointPredicate
+       describing the inside of a digital shape, whose evaluation is
+       thread-safe.
+       
+       @param out_it any output iterator for writing the cells.
+       
+       @param aKSpace any space.
+
+       @param pp an instance of a model of concepts::CPointPredicate, for
+       instance a SetPredicate for a digital set representing a shape.
+
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the extracted boundary.
+    */
+    template <typename OutputIterator, typename PointPredicate >
+    static 
+    void uParallelWriteBoundary( OutputIterator & out_it,
+                                 const KSpace & aKSpace,
+                                 const PointPredicate & pp,
+                                 const Point & aLowerBound, 
+                                 const Point & aUpperBound  );
+
+    /**
+       Writes on the output iterator @a out_it the signed surfels
+       of sMakeBoundary, in increasing order (the order of
+       std::set<SCell>). The surfels of each slab of the domain along
+       the last axis are extracted and sorted in parallel if DGtal
+       has been built with OpenMP support, then merged.
+       
+       @tparam OutputIterator any output iterator (like
+       std::back_insert_iterator< std::vector<SCell> >).
+
+       @tparam PointPredicate a model of concepts::CPointPredicate
+       describing the inside of a digital shape, whose evaluation is
+       thread-safe.
+       
+       @param out_it any output iterator for writing the signed cells.
+       
+       @param aKSpace any space.
+
+       @param pp an instance of a model of concepts::CPointPredicate, for
+       instance a SetPredicate for a digital set representing a shape.
+
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the extracted boundary.
+    */
+    template <typename OutputIterator, typename PointPredicate >
+    static 
+    void sParallelWriteBoundary( OutputIterator & out_it,
+                                 const KSpace & aKSpace,
+                                 const PointPredicate & pp,
+                                 const Point & aLowerBound, 
+                                 const Point & aUpperBound  );
     
 
     
@@ -896,6 +1025,67 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+       Extracts the surfels between the spels of [aLowerBound,aUpperBound]
+       by slabs along the last axis, in parallel if DGtal has been
+       built with OpenMP support. The surfel between the spels p and
+       p+e_k belongs to the slab of p.
+
+       @tparam TCell either Cell or SCell.
+       @tparam PointPredicate a model of concepts::CPointPredicate.
+
+       @param[out] slabs the sorted surfels of each slab.
+       @param aKSpace any space.
+       @param pp an instance of a model of concepts::CPointPredicate.
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the extracted boundary.
+    */
+    template <typename TCell, typename PointPredicate >
+    static 
+    void extractSlabBoundaries( std::vector< std::vector<TCell> > & slabs,
+                                const KSpace & aKSpace,
+                                const PointPredicate & pp,
+                                const Point & aLowerBound, 
+                                const Point & aUpperBound  );
+
+    /**
+       Merges sorted sequences of cells into an output iterator, in
+       increasing order.
+
+       @tparam TCell either Cell or SCell.
+       @tparam OutputIterator any output iterator on TCell.
+
+       @param out_it any output iterator for writing the cells.
+       @param slabs the sorted sequences of cells.
+    */
+    template <typename TCell, typename OutputIterator >
+    static 
+    void mergeSlabBoundaries( OutputIterator & out_it,
+                              const std::vector< std::vector<TCell> > & slabs );
+
+    /**
+       @param aKSpace any space.
+       @param p any spel.
+       @param k any direction.
+       @param in_here 'true' if the spel is inside the shape.
+       @param[out] surfel the unsigned surfel between @a p and p+e_k.
+    */
+    static 
+    void boundarySurfel( Cell & surfel, const KSpace & aKSpace,
+                         const Cell & p, Dimension k, bool in_here );
+
+    /**
+       @param aKSpace any space.
+       @param p any spel.
+       @param k any direction.
+       @param in_here 'true' if the spel is inside the shape.
+       @param[out] surfel the signed surfel between @a p and p+e_k,
+       oriented as in sMakeBoundary.
+    */
+    static 
+    void boundarySurfel( SCell & surfel, const KSpace & aKSpace,
+                         const Cell & p, Dimension k, bool in_here );
+
   }; // end of class Surfaces
 
 
@@ -0,0 +1,81 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file SternBrocotCommon.h
+ * @ingroup Tests
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Tests shared by testSternBrocot, testLightSternBrocot and
+ * testLighterSternBrocot.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if !defined(__STERN_BROCOT_TESTS_COMMON_H__)
+#define __STERN_BROCOT_TESTS_COMMON_H__
+
+#include <cstdlib>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+
+/**
+   Fractions created concurrently (if OpenMP is enabled) in a tree
+   that is still growing. Each fraction is asked twice, so that
+   threads follow existing nodes while others create new ones.
+
+   @tparam SB any Stern-Brocot tree (SternBrocot, LightSternBrocot,
+   LighterSternBrocot).
+*/
+template <typename SB>
+bool
+testConcurrentFractions()
+{
+  typedef typename SB::Fraction Fraction;
+  typedef typename Fraction::Integer Integer;
+  DGtal::trace.beginBlock("Testing block: concurrent creation of fractions");
+  std::vector<Integer> ps, qs;
+  for ( unsigned int i = 0; i < 2000; ++i )
+    {
+      ps.push_back( Integer( rand() % 100000 + 1 ) );
+      qs.push_back( Integer( rand() % 100000 + 1 ) );
+    }
+  const long n = static_cast<long>( ps.size() );
+  long nbErrors = 0;
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) reduction(+:nbErrors)
+#endif
+  for ( long j = 0; j < 2 * n; ++j )
+    {
+      const long i = j % n;
+      DGtal::IntegerComputer<Integer> lic;
+      const Integer g = lic.gcd( ps[ i ], qs[ i ] );
+      Fraction f = SB::fraction( ps[ i ], qs[ i ] );
+      Fraction h = SB::fraction( qs[ i ], ps[ i ] );
+      if ( ! f.equals( ps[ i ] / g, qs[ i ] / g ) || ( f.inverse() != h ) )
+        ++nbErrors;
+    }
+  DGtal::trace.info() << nbErrors << " errors, "
+                      << SB::instance().nbFractions
+                      << " fractions in the tree." << std::endl;
+  DGtal::trace.endBlock();
+  return nbErrors == 0;
+}
+
+#endif
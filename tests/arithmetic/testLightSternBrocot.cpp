@@ -39,6 +39,7 @@
 #include "DGtal/arithmetic/Pattern.h"
 #include "DGtal/arithmetic/StandardDSLQ0.h"
 #include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "SternBrocotCommon.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -730,6 +731,7 @@ bool testLightSternBrocot()
   return nbok == nb;
 }
 
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -770,7 +772,8 @@ int main( int , char** )
   bool res = testLightSternBrocot()
     && testPattern<SB>()
     && testSubStandardDSLQ0<Fraction>()
-    && testAncestors<SB>();
+    && testAncestors<SB>()
+    && testConcurrentFractions<SB>();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
 
@@ -42,6 +42,7 @@
 #include "DGtal/arithmetic/Pattern.h"
 #include "DGtal/arithmetic/StandardDSLQ0.h"
 #include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "SternBrocotCommon.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -842,6 +843,8 @@ testAncestors()
   std::cerr << D1 << std::endl;
   return D1.slope() == Fraction( 1, 1 );
 }
+
+
   
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
@@ -867,7 +870,8 @@ int main( int , char** )
     && testPattern<SB>()
     && testSubStandardDSLQ0<Fraction>()
     && testContinuedFractions<SB>()
-    && testAncestors<SB>();
+    && testAncestors<SB>()
+    && testConcurrentFractions<SB>();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
 
@@ -0,0 +1,170 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testStandardDSLQ0-parallel-smartDSS-benchmark.cpp
+ * @ingroup Tests
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of smartDSS and reversedSmartDSS when the subsegments are
+ * computed concurrently (OpenMP), with the three Stern-Brocot trees.
+ * Derived from testStandardDSLQ0-smartDSS-benchmark.cpp.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/arithmetic/SternBrocot.h"
+#include "DGtal/arithmetic/LightSternBrocot.h"
+#include "DGtal/arithmetic/LighterSternBrocot.h"
+#include "DGtal/arithmetic/Pattern.h"
+#include "DGtal/arithmetic/StandardDSLQ0.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking concurrent StandardDSLQ0 subsegments.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Parameters of one subsegment computation: the DSL (a,b,mu) and the
+ * abscissas of the extremities.
+ */
+struct SubSegmentTry
+{
+  DGtal::int64_t a, b, mu, x1, x2;
+};
+
+/**
+ * Computes the subsegments of the given tries, in parallel if OpenMP
+ * is enabled, and prints the time per subsegment.
+ *
+ * @param name the name of the Stern-Brocot tree.
+ * @param tries the parameters of the subsegments.
+ * @param reversed when 'true', uses reversedSmartDSS instead of smartDSS.
+ * @param modx the maximal length of the subsegments (for display).
+ * @return 'true' if the parallel results equal the sequential ones.
+ */
+template <typename Fraction>
+bool benchSubStandardDSLQ0( const std::string & name,
+                            const std::vector<SubSegmentTry> & tries,
+                            bool reversed, DGtal::int64_t modx )
+{
+  typedef StandardDSLQ0<Fraction> DSL;
+  typedef typename Fraction::Integer Integer;
+  typedef typename DSL::Point Point;
+
+  const long n = static_cast<long>( tries.size() );
+  std::vector<Integer> slopes( 2 * n );
+
+  trace.beginBlock( name );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for ( long i = 0; i < n; ++i )
+    {
+      const SubSegmentTry & t = tries[ i ];
+      DSL D( Integer( t.a ), Integer( t.b ), Integer( t.mu ) );
+      Point A = D.lowestY( Integer( t.x1 ) );
+      Point B = D.lowestY( Integer( t.x2 ) );
+      DSL S = reversed ? D.reversedSmartDSS( A, B ) : D.smartDSS( A, B );
+      slopes[ 2 * i ] = S.a();
+      slopes[ 2 * i + 1 ] = S.b();
+    }
+  double time = trace.endBlock();
+
+  // sequential check
+  bool ok = true;
+  for ( long i = 0; ok && i < n; ++i )
+    {
+      const SubSegmentTry & t = tries[ i ];
+      DSL D( Integer( t.a ), Integer( t.b ), Integer( t.mu ) );
+      Point A = D.lowestY( Integer( t.x1 ) );
+      Point B = D.lowestY( Integer( t.x2 ) );
+      DSL S = reversed ? D.reversedSmartDSS( A, B ) : D.smartDSS( A, B );
+      ok = ( S.a() == slopes[ 2 * i ] ) && ( S.b() == slopes[ 2 * i + 1 ] );
+    }
+  std::cout << name << " " << modx << " " << time / n << " ms "
+            << ( ok ? "OK" : "KO" ) << std::endl;
+  return ok;
+}
+
+/**
+ * Draws the parameters of subsegments, like in
+ * testStandardDSLQ0-smartDSS-benchmark.cpp.
+ */
+std::vector<SubSegmentTry> makeTries( unsigned int nbtries,
+                                      DGtal::int64_t moda, DGtal::int64_t modb,
+                                      DGtal::int64_t modx )
+{
+  IntegerComputer<DGtal::int64_t> ic;
+  std::vector<SubSegmentTry> tries;
+  for ( unsigned int i = 0; i < nbtries; ++i )
+    {
+      DGtal::int64_t b( rand() % modb + 1 );
+      DGtal::int64_t a( rand() % b + 1 );
+      if ( ic.gcd( a, b ) == 1 )
+        for ( unsigned int mu = 0; mu < 5; ++mu )
+          {
+            DGtal::int64_t c = rand() % ( moda + modb );
+            for ( unsigned int x = 0; x < 10; ++x )
+              {
+                SubSegmentTry t;
+                t.a = a; t.b = b; t.mu = c;
+                t.x1 = rand() % modx;
+                t.x2 = t.x1 + 1 + ( rand() % modx );
+                tries.push_back( t );
+              }
+          }
+    }
+  return tries;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv)
+{
+  typedef SternBrocot<DGtal::int64_t,DGtal::int32_t> SB;
+  typedef LightSternBrocot<DGtal::int64_t,DGtal::int32_t> LSB;
+  typedef LighterSternBrocot<DGtal::int64_t,DGtal::int32_t, StdMapRebinder> LrSB;
+  unsigned int nbtries = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 1000;
+
+  DGtal::int64_t modb = 1000000000000;
+  DGtal::int64_t moda = modb;
+
+  bool ok = true;
+  for ( DGtal::int64_t modx = 10; modx < modb/2; modx *= 16 )
+    {
+      std::vector<SubSegmentTry> tries = makeTries( nbtries, moda, modb, modx );
+      ok = benchSubStandardDSLQ0<SB::Fraction>( "SB-smartDSS", tries, false, modx ) && ok;
+      ok = benchSubStandardDSLQ0<SB::Fraction>( "SB-reversedSmartDSS", tries, true, modx ) && ok;
+      ok = benchSubStandardDSLQ0<LSB::Fraction>( "LSB-reversedSmartDSS", tries, true, modx ) && ok;
+      ok = benchSubStandardDSLQ0<LrSB::Fraction>( "LrSB-reversedSmartDSS", tries, true, modx ) && ok;
+    }
+  return ok ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -38,6 +38,7 @@
 #include "DGtal/arithmetic/Pattern.h"
 #include "DGtal/arithmetic/StandardDSLQ0.h"
 #include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "SternBrocotCommon.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -860,7 +861,6 @@ testSimplestFractionInBetween()
 }
 
 
-
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -879,7 +879,8 @@ int main( int , char** )
     && testSubStandardDSLQ0<Fraction>()
     && testContinuedFractions<SB>()
     && testAncestors<SB>()
-    && testSimplestFractionInBetween<SB>();
+    && testSimplestFractionInBetween<SB>()
+    && testConcurrentFractions<SB>();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -311,6 +311,166 @@ test_derivative(int domain_size)
     }
 }
 
+template <typename DigitalSet, typename LinearAlgebraBackend>
+void
+test_operator_cache(int domain_size)
+{
+    typedef typename DigitalSet::Domain Domain;
+    typedef typename DigitalSet::Point Point;
+    DGtal::trace.info() << "dimension=" << Point::dimension << std::endl;
+    Domain domain(Point(), Point::diagonal(domain_size-1));
+
+    DigitalSet set(domain);
+    for (typename Domain::ConstIterator di=domain.begin(), die=domain.end(); di!=die; di++)
+    {
+        if (std::rand()%3!=0) continue;
+        set.insertNew(*di);
+    }
+
+    typedef DGtal::DiscreteExteriorCalculusFactory<LinearAlgebraBackend> CalculusFactory;
+    typedef DGtal::DiscreteExteriorCalculus<Domain::Space::dimension, Domain::Space::dimension, LinearAlgebraBackend> Calculus;
+    Calculus calculus = CalculusFactory::createFromDigitalSet(set, true);
+
+    DGtal::trace.beginBlock("testing cached operators");
+
+    typedef DGtal::LinearOperator<Calculus, 0, DGtal::PRIMAL, 1, DGtal::PRIMAL> Derivative;
+    typedef DGtal::LinearOperator<Calculus, 1, DGtal::PRIMAL, 0, DGtal::PRIMAL> Antiderivative;
+    typedef DGtal::LinearOperator<Calculus, 0, DGtal::PRIMAL, 0, DGtal::PRIMAL> Laplace;
+    typedef DGtal::LinearOperator<Calculus, 0, DGtal::PRIMAL, Calculus::dimensionEmbedded, DGtal::DUAL> Hodge;
+
+    const Derivative derivative = calculus.template derivative<0, DGtal::PRIMAL>();
+    const Antiderivative antiderivative = calculus.template antiderivative<1, DGtal::PRIMAL>();
+    const Hodge hodge = calculus.template hodge<0, DGtal::PRIMAL>();
+    FATAL_ERROR( equal(derivative.myContainer, calculus.template derivative<0, DGtal::PRIMAL>().myContainer) );
+    FATAL_ERROR( equal(antiderivative.myContainer, calculus.template antiderivative<1, DGtal::PRIMAL>().myContainer) );
+    FATAL_ERROR( equal(hodge.myContainer, calculus.template hodge<0, DGtal::PRIMAL>().myContainer) );
+
+    const Laplace laplace = calculus.template laplace<DGtal::PRIMAL>();
+    const Laplace composed_laplace = antiderivative * derivative;
+    FATAL_ERROR( equal(laplace.myContainer, composed_laplace.myContainer) );
+    FATAL_ERROR( equal(laplace.myContainer, calculus.template laplace<DGtal::PRIMAL>().myContainer) );
+
+    // operators requested concurrently from a calculus with an empty cache
+    {
+        Calculus fresh_calculus = CalculusFactory::createFromDigitalSet(set, true);
+        long nb_errors = 0;
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static) reduction(+:nb_errors)
+#endif
+        for (long kk=0; kk<16; kk++)
+        {
+            if (!equal(laplace.myContainer, fresh_calculus.template laplace<DGtal::PRIMAL>().myContainer)) nb_errors++;
+            if (!equal(hodge.myContainer, fresh_calculus.template hodge<0, DGtal::PRIMAL>().myContainer)) nb_errors++;
+        }
+        FATAL_ERROR( nb_errors == 0 );
+    }
+
+    // erasing a cell invalidates cached operators
+    const typename Calculus::Cell point = calculus.myKSpace.unsigns(calculus.getSCell(0, DGtal::PRIMAL, 0));
+    calculus.eraseCell(point);
+    calculus.updateIndexes();
+    const Derivative erased_derivative = calculus.template derivative<0, DGtal::PRIMAL>();
+    FATAL_ERROR( erased_derivative.myContainer.cols() == derivative.myContainer.cols()-1 );
+    FATAL_ERROR( erased_derivative.myContainer.cols() == calculus.kFormLength(0, DGtal::PRIMAL) );
+    FATAL_ERROR( calculus.template laplace<DGtal::PRIMAL>().myContainer.rows() == calculus.kFormLength(0, DGtal::PRIMAL) );
+
+    DGtal::trace.endBlock();
+}
+
+template <typename Calculus>
+bool
+same_structure(const Calculus& aa, const Calculus& bb)
+{
+    if (aa.getProperties().size() != bb.getProperties().size()) return false;
+    for (typename Calculus::Properties::const_iterator pi=aa.getProperties().begin(), pe=aa.getProperties().end(); pi!=pe; pi++)
+    {
+        const typename Calculus::Properties::const_iterator pj = bb.getProperties().find(pi->first);
+        if (pj == bb.getProperties().end()) return false;
+        if (pi->second.primal_size != pj->second.primal_size) return false;
+        if (pi->second.dual_size != pj->second.dual_size) return false;
+        if (pi->second.flipped != pj->second.flipped) return false;
+
+        const DGtal::Dimension dim = aa.myKSpace.uDim(pi->first);
+        if (aa.myKSpace.unsigns(aa.getSCell(dim, DGtal::PRIMAL, pi->second.index)) != pi->first) return false;
+    }
+    return true;
+}
+
+template <typename DigitalSet, typename LinearAlgebraBackend>
+void
+test_factory(int domain_size)
+{
+    typedef typename DigitalSet::Domain Domain;
+    typedef typename DigitalSet::Point Point;
+    DGtal::trace.info() << "dimension=" << Point::dimension << std::endl;
+    Domain domain(Point(), Point::diagonal(domain_size-1));
+
+    DigitalSet set(domain);
+    for (typename Domain::ConstIterator di=domain.begin(), die=domain.end(); di!=die; di++)
+    {
+        if (std::rand()%3==0) continue;
+        set.insertNew(*di);
+    }
+
+    typedef DGtal::DiscreteExteriorCalculusFactory<LinearAlgebraBackend> CalculusFactory;
+    typedef DGtal::DiscreteExteriorCalculus<Domain::Space::dimension, Domain::Space::dimension, LinearAlgebraBackend> Calculus;
+    typedef typename Calculus::Cell Cell;
+
+    for (int border=0; border<2; border++)
+    {
+        DGtal::trace.beginBlock(border ? "testing factory with border" : "testing factory without border");
+
+        // reference structure, built cell by cell
+        Calculus reference;
+        reference.template initKSpace<Domain>(domain);
+        typedef std::map<Cell, int> Accum;
+        Accum accum;
+        for (typename DigitalSet::ConstIterator si=set.begin(), se=set.end(); si!=se; si++)
+        {
+            const Point cell_coords = reference.myKSpace.uKCoords(reference.myKSpace.uSpel(*si));
+            const Domain neighborhood(cell_coords-Point::diagonal(1), cell_coords+Point::diagonal(1));
+            for (typename Domain::ConstIterator pi=neighborhood.begin(), pe=neighborhood.end(); pi!=pe; pi++)
+                accum[reference.myKSpace.uCell(*pi)]++;
+        }
+        for (typename Accum::const_iterator ai=accum.begin(), ae=accum.end(); ai!=ae; ai++)
+        {
+            const DGtal::Dimension dual_dim = Calculus::dimensionEmbedded-reference.myKSpace.uDim(ai->first);
+            const double size = ai->second * pow(.5, dual_dim);
+            if (!border && size < 1) continue;
+            reference.insertSCell(reference.myKSpace.signs(ai->first, Calculus::KSpace::POS), 1, size);
+        }
+        reference.updateIndexes();
+
+        const Calculus calculus = CalculusFactory::createFromDigitalSet(set, border != 0);
+        DGtal::trace.info() << "properties.size()=" << calculus.getProperties().size() << std::endl;
+        FATAL_ERROR( same_structure(calculus, reference) );
+
+        DGtal::trace.endBlock();
+    }
+
+    if (Point::dimension != 2) return;
+
+    DGtal::trace.beginBlock("testing factory from n-cells and cubical complex");
+
+    typedef typename Calculus::KSpace KSpace;
+    typedef DGtal::CubicalComplex<KSpace> Complex;
+    const Calculus calculus = CalculusFactory::createFromDigitalSet(set, true);
+    Complex complex(calculus.myKSpace);
+    std::vector<typename Calculus::SCell> ncells;
+    for (typename DigitalSet::ConstIterator si=set.begin(), se=set.end(); si!=se; si++)
+    {
+        complex.insertCell(calculus.myKSpace.uSpel(*si));
+        ncells.push_back(calculus.myKSpace.sSpel(*si));
+    }
+
+    const Calculus calculus_ncells = CalculusFactory::template createFromNSCells<Calculus::dimensionEmbedded>(ncells.begin(), ncells.end(), true);
+    const Calculus calculus_complex = CalculusFactory::template createFromCubicalComplex<Calculus::dimensionEmbedded>(complex, true);
+    FATAL_ERROR( same_structure(calculus_ncells, calculus) );
+    FATAL_ERROR( same_structure(calculus_complex, calculus) );
+
+    DGtal::trace.endBlock();
+}
+
 template <typename LinearAlgebraBackend>
 void
 test_concepts()
@@ -547,6 +707,16 @@ test_backend(const int& ntime, const int& maxdim)
         if (maxdim>=6) test_derivative<DigitalSet6, LinearAlgebraBackend>(3);
         if (maxdim>=7) test_derivative<DigitalSet7, LinearAlgebraBackend>(2);
         DGtal::trace.endBlock();
+
+        DGtal::trace.beginBlock("testing factory");
+        if (maxdim>=2) test_factory<DGtal::Z2i::DigitalSet, LinearAlgebraBackend>(6);
+        if (maxdim>=3) test_factory<DGtal::Z3i::DigitalSet, LinearAlgebraBackend>(5);
+        DGtal::trace.endBlock();
+
+        DGtal::trace.beginBlock("testing operator caches");
+        if (maxdim>=2) test_operator_cache<DGtal::Z2i::DigitalSet, LinearAlgebraBackend>(5);
+        if (maxdim>=3) test_operator_cache<DGtal::Z3i::DigitalSet, LinearAlgebraBackend>(5);
+        DGtal::trace.endBlock();
     }
 
     test_concepts<LinearAlgebraBackend>();
@@ -0,0 +1,223 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDiscreteExteriorCalculusMultigrid.cpp
+ * @ingroup Tests
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class DiscreteExteriorCalculusMultigrid.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#include "DECCommon.h"
+#include "DGtal/math/linalg/CLinearAlgebraSolver.h"
+#include "DGtal/dec/DiscreteExteriorCalculusMultigrid.h"
+
+template <typename DigitalSet>
+DigitalSet
+make_ball(int domain_size)
+{
+    typedef typename DigitalSet::Domain Domain;
+    typedef typename DigitalSet::Point Point;
+
+    const Domain domain(Point(), Point::diagonal(domain_size-1));
+    DigitalSet set(domain);
+    for (typename Domain::ConstIterator di=domain.begin(), die=domain.end(); di!=die; di++)
+        if ((*di - Point::diagonal(domain_size/2)).norm() < domain_size/2.2) set.insertNew(*di);
+    return set;
+}
+
+template <typename Calculus, DGtal::Duality duality>
+typename Calculus::DenseVector
+random_values(const Calculus& calculus)
+{
+    typename Calculus::DenseVector values(calculus.kFormLength(0, duality));
+    for (typename Calculus::Index ii=0; ii<values.rows(); ii++)
+        values(ii) = static_cast<double>(std::rand())/RAND_MAX - .5;
+    return values;
+}
+
+template <typename Calculus>
+void
+test_transfers(const DGtal::DiscreteExteriorCalculusMultigrid<Calculus>& multigrid)
+{
+    typedef typename Calculus::DenseVector DenseVector;
+
+    for (std::size_t level=0; level+1<multigrid.nbLevels(); level++)
+    {
+        const DenseVector ones = multigrid.prolongation(level, DenseVector::Ones(multigrid.levelSize(level+1)));
+        FATAL_ERROR( ones.rows() == multigrid.levelSize(level) );
+        for (typename Calculus::Index ii=0; ii<ones.rows(); ii++)
+            FATAL_ERROR( std::abs(ones(ii)-1) < 1e-12 );
+
+        DenseVector fine(multigrid.levelSize(level));
+        for (typename Calculus::Index ii=0; ii<fine.rows(); ii++)
+            fine(ii) = static_cast<double>(std::rand())/RAND_MAX - .5;
+        DenseVector coarse(multigrid.levelSize(level+1));
+        for (typename Calculus::Index ii=0; ii<coarse.rows(); ii++)
+            coarse(ii) = static_cast<double>(std::rand())/RAND_MAX - .5;
+
+        // restriction is the transposed prolongation
+        FATAL_ERROR( std::abs(multigrid.restriction(level, fine).dot(coarse) - fine.dot(multigrid.prolongation(level, coarse))) < 1e-10 * fine.rows() );
+    }
+}
+
+void
+test_standalone()
+{
+    typedef DGtal::DiscreteExteriorCalculusFactory<DGtal::EigenLinearAlgebraBackend> CalculusFactory;
+    typedef DGtal::DiscreteExteriorCalculus<2, 2, DGtal::EigenLinearAlgebraBackend> Calculus;
+    typedef DGtal::DiscreteExteriorCalculusMultigrid<Calculus> Multigrid;
+
+    BOOST_CONCEPT_ASSERT(( DGtal::concepts::CLinearAlgebraSolver<Multigrid, Calculus::DenseVector, Calculus::SparseMatrix> ));
+
+    DGtal::trace.beginBlock("testing standalone multigrid, dual poisson in 2d");
+
+    const DGtal::Z2i::DigitalSet set = make_ball<DGtal::Z2i::DigitalSet>(80);
+    const Calculus calculus = CalculusFactory::createFromDigitalSet(set, false);
+    DGtal::trace.info() << calculus << std::endl;
+
+    const Calculus::DualIdentity0 laplace = calculus.laplace<DGtal::DUAL>() + 1e-3 * calculus.identity<0, DGtal::DUAL>();
+    const Calculus::DualForm0 input(calculus, random_values<Calculus, DGtal::DUAL>(calculus));
+
+    typedef DGtal::DiscreteExteriorCalculusSolver<Calculus, Multigrid, 0, DGtal::DUAL, 0, DGtal::DUAL> Solver;
+    Solver solver;
+    solver.myLinearAlgebraSolver.setHierarchy(calculus, set, DGtal::DUAL, false, 16, 50);
+    solver.myLinearAlgebraSolver.setTolerance(1e-10);
+    solver.compute(laplace);
+    const Calculus::DualForm0 solution = solver.solve(input);
+    DGtal::trace.info() << solver.myLinearAlgebraSolver << std::endl;
+    FATAL_ERROR( solver.isValid() );
+    FATAL_ERROR( solver.myLinearAlgebraSolver.nbLevels() > 2 );
+    FATAL_ERROR( solver.myLinearAlgebraSolver.iterations() < 40 );
+    test_transfers(solver.myLinearAlgebraSolver);
+
+    typedef DGtal::DiscreteExteriorCalculusSolver<Calculus, DGtal::EigenLinearAlgebraBackend::SolverSimplicialLLT, 0, DGtal::DUAL, 0, DGtal::DUAL> DirectSolver;
+    DirectSolver direct_solver;
+    direct_solver.compute(laplace);
+    const Calculus::DualForm0 solution_reference = direct_solver.solve(input);
+    FATAL_ERROR( direct_solver.isValid() );
+
+    const double difference = (solution.myContainer - solution_reference.myContainer).cwiseAbs().maxCoeff();
+    const double scale = solution_reference.myContainer.cwiseAbs().maxCoeff();
+    DGtal::trace.info() << "difference=" << difference << " scale=" << scale << std::endl;
+    FATAL_ERROR( difference < 1e-6 * scale );
+
+    // without hierarchy, the solver falls back to the coarse factorization
+    Multigrid direct_multigrid;
+    direct_multigrid.compute(laplace.myContainer);
+    const Calculus::DenseVector direct_solution = direct_multigrid.solve(input.myContainer);
+    FATAL_ERROR( direct_multigrid.info() == Eigen::Success );
+    FATAL_ERROR( direct_multigrid.nbLevels() == 1 );
+    FATAL_ERROR( (direct_solution - solution_reference.myContainer).cwiseAbs().maxCoeff() < 1e-8 * scale );
+
+    DGtal::trace.endBlock();
+}
+
+void
+test_preconditioner()
+{
+    typedef DGtal::DiscreteExteriorCalculusFactory<DGtal::EigenLinearAlgebraBackend> CalculusFactory;
+    typedef DGtal::DiscreteExteriorCalculus<3, 3, DGtal::EigenLinearAlgebraBackend> Calculus;
+    typedef DGtal::DiscreteExteriorCalculusMultigrid<Calculus> Multigrid;
+
+    const DGtal::Z3i::DigitalSet set = make_ball<DGtal::Z3i::DigitalSet>(24);
+
+    {
+        DGtal::trace.beginBlock("testing multigrid preconditioned conjugate gradient, dual heat in 3d");
+
+        const Calculus calculus = CalculusFactory::createFromDigitalSet(set, false);
+        DGtal::trace.info() << calculus << std::endl;
+
+        const Calculus::DualIdentity0 heat = calculus.identity<0, DGtal::DUAL>() + 10. * calculus.laplace<DGtal::DUAL>();
+        const Calculus::DualForm0 input(calculus, random_values<Calculus, DGtal::DUAL>(calculus));
+
+        typedef DGtal::DiscreteExteriorCalculusSolver<Calculus, Multigrid::SolverConjugateGradient, 0, DGtal::DUAL, 0, DGtal::DUAL> Solver;
+        Solver solver;
+        solver.myLinearAlgebraSolver.preconditioner().setHierarchy(calculus, set, DGtal::DUAL, false, 16, 200);
+        solver.myLinearAlgebraSolver.setTolerance(1e-10);
+        solver.compute(heat);
+        const Calculus::DualForm0 solution = solver.solve(input);
+        DGtal::trace.info() << solver.myLinearAlgebraSolver.preconditioner() << " cg_iterations=" << solver.myLinearAlgebraSolver.iterations() << std::endl;
+        FATAL_ERROR( solver.isValid() );
+        FATAL_ERROR( solver.myLinearAlgebraSolver.preconditioner().nbLevels() > 2 );
+        test_transfers(solver.myLinearAlgebraSolver.preconditioner());
+
+        typedef DGtal::DiscreteExteriorCalculusSolver<Calculus, DGtal::EigenLinearAlgebraBackend::SolverConjugateGradient, 0, DGtal::DUAL, 0, DGtal::DUAL> PlainSolver;
+        PlainSolver plain_solver;
+        plain_solver.myLinearAlgebraSolver.setTolerance(1e-10);
+        plain_solver.compute(heat);
+        const Calculus::DualForm0 solution_reference = plain_solver.solve(input);
+        DGtal::trace.info() << "plain_cg_iterations=" << plain_solver.myLinearAlgebraSolver.iterations() << std::endl;
+        FATAL_ERROR( plain_solver.isValid() );
+        FATAL_ERROR( solver.myLinearAlgebraSolver.iterations() < plain_solver.myLinearAlgebraSolver.iterations() );
+
+        const double difference = (solution.myContainer - solution_reference.myContainer).cwiseAbs().maxCoeff();
+        const double scale = solution_reference.myContainer.cwiseAbs().maxCoeff();
+        DGtal::trace.info() << "difference=" << difference << " scale=" << scale << std::endl;
+        FATAL_ERROR( difference < 1e-6 * scale );
+
+        DGtal::trace.endBlock();
+    }
+
+    {
+        DGtal::trace.beginBlock("testing standalone multigrid, primal heat in 3d");
+
+        const Calculus calculus = CalculusFactory::createFromDigitalSet(set, true);
+        DGtal::trace.info() << calculus << std::endl;
+
+        // primal laplace is not symmetric when the border is added
+        const Calculus::PrimalIdentity0 heat = calculus.identity<0, DGtal::PRIMAL>() + 10. * calculus.laplace<DGtal::PRIMAL>();
+        const Calculus::PrimalForm0 input(calculus, random_values<Calculus, DGtal::PRIMAL>(calculus));
+
+        typedef DGtal::DiscreteExteriorCalculusSolver<Calculus, Multigrid, 0, DGtal::PRIMAL, 0, DGtal::PRIMAL> Solver;
+        Solver solver;
+        solver.myLinearAlgebraSolver.setHierarchy(calculus, set, DGtal::PRIMAL, true, 16, 200);
+        solver.myLinearAlgebraSolver.setTolerance(1e-10);
+        solver.compute(heat);
+        const Calculus::PrimalForm0 solution = solver.solve(input);
+        DGtal::trace.info() << solver.myLinearAlgebraSolver << std::endl;
+        FATAL_ERROR( solver.isValid() );
+        FATAL_ERROR( solver.myLinearAlgebraSolver.iterations() < 40 );
+        test_transfers(solver.myLinearAlgebraSolver);
+
+        typedef DGtal::DiscreteExteriorCalculusSolver<Calculus, DGtal::EigenLinearAlgebraBackend::SolverSparseLU, 0, DGtal::PRIMAL, 0, DGtal::PRIMAL> DirectSolver;
+        DirectSolver direct_solver;
+        direct_solver.compute(heat);
+        const Calculus::PrimalForm0 solution_reference = direct_solver.solve(input);
+        FATAL_ERROR( direct_solver.isValid() );
+
+        const double difference = (solution.myContainer - solution_reference.myContainer).cwiseAbs().maxCoeff();
+        const double scale = solution_reference.myContainer.cwiseAbs().maxCoeff();
+        DGtal::trace.info() << "difference=" << difference << " scale=" << scale << std::endl;
+        FATAL_ERROR( difference < 1e-6 * scale );
+
+        DGtal::trace.endBlock();
+    }
+}
+
+int
+main(int /*argc*/, char** /*argv*/)
+{
+    test_standalone();
+    test_preconditioner();
+
+    return 0;
+}
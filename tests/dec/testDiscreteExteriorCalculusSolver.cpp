@@ -0,0 +1,208 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDiscreteExteriorCalculusSolver.cpp
+ * @ingroup Tests
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing repeated solves with class DiscreteExteriorCalculusSolver.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#include "DECCommon.h"
+
+typedef DGtal::DiscreteExteriorCalculusFactory<DGtal::EigenLinearAlgebraBackend> CalculusFactory;
+typedef DGtal::DiscreteExteriorCalculus<2, 2, DGtal::EigenLinearAlgebraBackend> Calculus;
+
+Calculus
+make_calculus()
+{
+    typedef DGtal::Z2i::Point Point;
+    const DGtal::Z2i::Domain domain(Point(0,0), Point(39,39));
+    DGtal::Z2i::DigitalSet set(domain);
+    for (DGtal::Z2i::Domain::ConstIterator di=domain.begin(), die=domain.end(); di!=die; di++)
+        if ((*di - Point(20,20)).norm() < 17) set.insertNew(*di);
+    return CalculusFactory::createFromDigitalSet(set, false);
+}
+
+Calculus::DualForm0
+random_form(const Calculus& calculus)
+{
+    Calculus::DualForm0 form(calculus);
+    for (Calculus::Index ii=0; ii<form.length(); ii++)
+        form.myContainer(ii) = static_cast<double>(std::rand())/RAND_MAX;
+    return form;
+}
+
+double
+max_difference(const Calculus::DualForm0& aa, const Calculus::DualForm0& bb)
+{
+    return (aa.myContainer - bb.myContainer).cwiseAbs().maxCoeff();
+}
+
+void
+test_factorization_reuse(const Calculus& calculus)
+{
+    DGtal::trace.beginBlock("testing factorization reuse");
+
+    typedef DGtal::DiscreteExteriorCalculusSolver<Calculus, DGtal::EigenLinearAlgebraBackend::SolverSimplicialLLT, 0, DGtal::DUAL, 0, DGtal::DUAL> Solver;
+
+    const Calculus::DualIdentity0 laplace = calculus.laplace<DGtal::DUAL>();
+    const Calculus::DualIdentity0 identity = calculus.identity<0, DGtal::DUAL>();
+    const Calculus::DualForm0 input = random_form(calculus);
+
+    Solver solver;
+    for (int kk=1; kk<=4; kk++)
+    {
+        const Calculus::DualIdentity0 heat = identity + (.1 * kk) * laplace;
+        solver.update(heat);
+        FATAL_ERROR( solver.isValid() );
+        const Calculus::DualForm0 solution = solver.solve(input);
+
+        Solver solver_reference;
+        solver_reference.compute(heat);
+        FATAL_ERROR( max_difference(solution, solver_reference.solve(input)) < 1e-12 );
+    }
+    DGtal::trace.info() << solver << std::endl;
+    FATAL_ERROR( solver.statistics().nb_analyses == 1 );
+    FATAL_ERROR( solver.statistics().nb_factorizations == 4 );
+    FATAL_ERROR( solver.statistics().nb_solves == 0 );
+
+    // a different sparsity pattern triggers a new symbolic factorization
+    const Calculus::DualIdentity0 bilaplace = identity + laplace * laplace;
+    solver.update(bilaplace);
+    FATAL_ERROR( solver.isValid() );
+    FATAL_ERROR( solver.statistics().nb_analyses == 2 );
+    FATAL_ERROR( solver.statistics().nb_factorizations == 5 );
+
+    // factorize falls back to a symbolic factorization as well
+    const Calculus::DualIdentity0 heat = identity + .5 * laplace;
+    solver.factorize(heat);
+    FATAL_ERROR( solver.isValid() );
+    FATAL_ERROR( solver.statistics().nb_analyses == 3 );
+    FATAL_ERROR( max_difference(solver.solve(input), Solver().compute(heat).solve(input)) < 1e-12 );
+
+    // compute does not record the sparsity pattern
+    solver.compute(heat);
+    solver.update(heat);
+    FATAL_ERROR( solver.statistics().nb_analyses == 5 );
+
+    solver.resetStatistics();
+    FATAL_ERROR( solver.statistics().nb_analyses == 0 );
+    FATAL_ERROR( solver.statistics().factorize_time == 0 );
+
+    DGtal::trace.endBlock();
+}
+
+void
+test_multiple_inputs(const Calculus& calculus)
+{
+    DGtal::trace.beginBlock("testing multiple right hand sides");
+
+    typedef DGtal::DiscreteExteriorCalculusSolver<Calculus, DGtal::EigenLinearAlgebraBackend::SolverSimplicialLDLT, 0, DGtal::DUAL, 0, DGtal::DUAL> Solver;
+
+    Solver solver;
+    solver.compute(calculus.identity<0, DGtal::DUAL>() + .5 * calculus.laplace<DGtal::DUAL>());
+    FATAL_ERROR( solver.isValid() );
+
+    Solver::InputKForms inputs;
+    for (int kk=0; kk<5; kk++) inputs.push_back(random_form(calculus));
+
+    const Solver::SolutionKForms solutions = solver.solve(inputs);
+    FATAL_ERROR( solutions.size() == inputs.size() );
+    for (std::size_t kk=0; kk<inputs.size(); kk++)
+        FATAL_ERROR( max_difference(solutions[kk], solver.solve(inputs[kk])) < 1e-12 );
+
+    DGtal::trace.info() << solver << std::endl;
+    FATAL_ERROR( solver.statistics().nb_solves == 0 );
+
+    Solver::Statistics statistics;
+    solver.solve(inputs, &statistics);
+    solver.solve(inputs.front(), &statistics);
+    FATAL_ERROR( statistics.nb_solves == 2 );
+    FATAL_ERROR( statistics.nb_right_hand_sides == inputs.size() + 1 );
+    FATAL_ERROR( statistics.solve_time >= 0 );
+    FATAL_ERROR( solver.statistics().nb_solves == 0 );
+
+    FATAL_ERROR( solver.solve(Solver::InputKForms()).empty() );
+
+    DGtal::trace.endBlock();
+}
+
+void
+test_warm_start(const Calculus& calculus)
+{
+    DGtal::trace.beginBlock("testing warm started solves");
+
+    typedef DGtal::DiscreteExteriorCalculusSolver<Calculus, DGtal::EigenLinearAlgebraBackend::SolverConjugateGradient, 0, DGtal::DUAL, 0, DGtal::DUAL> Solver;
+
+    const Calculus::DualIdentity0 heat = calculus.identity<0, DGtal::DUAL>() + .05 * calculus.laplace<DGtal::DUAL>();
+
+    Solver cold_solver;
+    cold_solver.myLinearAlgebraSolver.setTolerance(1e-10);
+    cold_solver.compute(heat);
+
+    Solver warm_solver;
+    warm_solver.myLinearAlgebraSolver.setTolerance(1e-10);
+    warm_solver.compute(heat);
+
+    // implicit heat steps: the previous solution is the next input
+    Calculus::DualForm0 cold_state = random_form(calculus);
+    Calculus::DualForm0 warm_state = cold_state;
+    int cold_iterations = 0;
+    int warm_iterations = 0;
+    for (int kk=0; kk<10; kk++)
+    {
+        cold_state = cold_solver.solve(cold_state);
+        cold_iterations += cold_solver.myLinearAlgebraSolver.iterations();
+        FATAL_ERROR( cold_solver.isValid() );
+
+        warm_state = warm_solver.solveWarmStarted(warm_state);
+        warm_iterations += warm_solver.myLinearAlgebraSolver.iterations();
+        FATAL_ERROR( warm_solver.isValid() );
+
+        FATAL_ERROR( max_difference(cold_state, warm_state) < 1e-6 );
+    }
+
+    DGtal::trace.info() << "cold_iterations=" << cold_iterations << " warm_iterations=" << warm_iterations << std::endl;
+    DGtal::trace.info() << warm_solver << std::endl;
+    FATAL_ERROR( warm_iterations < cold_iterations );
+    FATAL_ERROR( warm_solver.statistics().nb_solves == 10 );
+
+    const Solver& const_warm_solver = warm_solver;
+    const Calculus::DualForm0 guessed = const_warm_solver.solveWithGuess(warm_state, warm_state);
+    FATAL_ERROR( max_difference(guessed, cold_solver.solve(warm_state)) < 1e-6 );
+    FATAL_ERROR( warm_solver.statistics().nb_solves == 10 );
+
+    DGtal::trace.endBlock();
+}
+
+int
+main(int /*argc*/, char** /*argv*/)
+{
+    const Calculus calculus = make_calculus();
+    DGtal::trace.info() << calculus << std::endl;
+
+    test_factorization_reuse(calculus);
+    test_multiple_inputs(calculus);
+    test_warm_start(calculus);
+
+    return 0;
+}
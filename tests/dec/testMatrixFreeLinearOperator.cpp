@@ -0,0 +1,182 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMatrixFreeLinearOperator.cpp
+ * @ingroup Tests
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class MatrixFreeLinearOperator.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#include "DECCommon.h"
+#include "DGtal/dec/MatrixFreeLinearOperator.h"
+
+template <typename Container>
+double
+max_difference(const Container& aa, const Container& bb)
+{
+    FATAL_ERROR( aa.rows() == bb.rows() );
+    return aa.rows() == 0 ? 0 : (aa-bb).cwiseAbs().maxCoeff();
+}
+
+template <typename Calculus, typename MatrixFreeOperator, typename Operator>
+bool
+same_operator(const Calculus& calculus, const MatrixFreeOperator& matrix_free_operator, const Operator& linear_operator)
+{
+    typedef typename Operator::InputKForm InputKForm;
+    InputKForm input(calculus);
+    for (typename Calculus::Index ii=0; ii<input.length(); ii++)
+        input.myContainer(ii) = static_cast<double>(std::rand())/RAND_MAX - .5;
+
+    const typename Operator::OutputKForm output = matrix_free_operator * input;
+    const typename Operator::OutputKForm output_reference = linear_operator * input;
+    const double difference = max_difference(output.myContainer, output_reference.myContainer);
+    DGtal::trace.info() << matrix_free_operator << " difference=" << difference << std::endl;
+    return difference < 1e-10;
+}
+
+template <typename DigitalSet>
+void
+test_operators(int domain_size)
+{
+    typedef typename DigitalSet::Domain Domain;
+    typedef typename DigitalSet::Point Point;
+    typedef DGtal::DiscreteExteriorCalculusFactory<DGtal::EigenLinearAlgebraBackend> CalculusFactory;
+    typedef DGtal::DiscreteExteriorCalculus<Domain::Space::dimension, Domain::Space::dimension, DGtal::EigenLinearAlgebraBackend> Calculus;
+    typedef DGtal::MatrixFreeOperatorFactory<Calculus> MatrixFreeFactory;
+
+    DGtal::trace.beginBlock("testing matrix free operators");
+    DGtal::trace.info() << "dimension=" << Point::dimension << std::endl;
+
+    const Domain domain(Point(), Point::diagonal(domain_size-1));
+    DigitalSet set(domain);
+    for (typename Domain::ConstIterator di=domain.begin(), die=domain.end(); di!=die; di++)
+        if ((*di - Point::diagonal(domain_size/2)).norm() < domain_size/2.5) set.insertNew(*di);
+
+    const Calculus calculus = CalculusFactory::createFromDigitalSet(set, true);
+    DGtal::trace.info() << calculus << std::endl;
+
+    FATAL_ERROR(( same_operator(calculus, MatrixFreeFactory::template derivative<0, DGtal::PRIMAL>(calculus), calculus.template derivative<0, DGtal::PRIMAL>()) ));
+    FATAL_ERROR(( same_operator(calculus, MatrixFreeFactory::template derivative<1, DGtal::PRIMAL>(calculus), calculus.template derivative<1, DGtal::PRIMAL>()) ));
+    FATAL_ERROR(( same_operator(calculus, MatrixFreeFactory::template derivative<0, DGtal::DUAL>(calculus), calculus.template derivative<0, DGtal::DUAL>()) ));
+    FATAL_ERROR(( same_operator(calculus, MatrixFreeFactory::template derivative<1, DGtal::DUAL>(calculus), calculus.template derivative<1, DGtal::DUAL>()) ));
+    FATAL_ERROR(( same_operator(calculus, MatrixFreeFactory::template hodge<0, DGtal::PRIMAL>(calculus), calculus.template hodge<0, DGtal::PRIMAL>()) ));
+    FATAL_ERROR(( same_operator(calculus, MatrixFreeFactory::template hodge<1, DGtal::DUAL>(calculus), calculus.template hodge<1, DGtal::DUAL>()) ));
+    FATAL_ERROR(( same_operator(calculus, MatrixFreeFactory::template antiderivative<1, DGtal::PRIMAL>(calculus), calculus.template antiderivative<1, DGtal::PRIMAL>()) ));
+    FATAL_ERROR(( same_operator(calculus, MatrixFreeFactory::template antiderivative<2, DGtal::DUAL>(calculus), calculus.template antiderivative<2, DGtal::DUAL>()) ));
+    FATAL_ERROR(( same_operator(calculus, MatrixFreeFactory::template laplace<DGtal::PRIMAL>(calculus), calculus.template laplace<DGtal::PRIMAL>()) ));
+    FATAL_ERROR(( same_operator(calculus, MatrixFreeFactory::template laplace<DGtal::DUAL>(calculus), calculus.template laplace<DGtal::DUAL>()) ));
+
+    FATAL_ERROR(( same_operator(calculus,
+                                MatrixFreeFactory::template laplace<DGtal::PRIMAL>(calculus) - 2. * MatrixFreeFactory::template identity<0, DGtal::PRIMAL>(calculus),
+                                calculus.template laplace<DGtal::PRIMAL>() - 2. * calculus.template identity<0, DGtal::PRIMAL>()) ));
+    FATAL_ERROR(( same_operator(calculus,
+                                -MatrixFreeFactory::template derivative<1, DGtal::PRIMAL>(calculus) * MatrixFreeFactory::template derivative<0, DGtal::PRIMAL>(calculus),
+                                -calculus.template derivative<1, DGtal::PRIMAL>() * calculus.template derivative<0, DGtal::PRIMAL>()) ));
+
+    DGtal::trace.endBlock();
+}
+
+void
+test_solvers()
+{
+    typedef DGtal::DiscreteExteriorCalculusFactory<DGtal::EigenLinearAlgebraBackend> CalculusFactory;
+    typedef DGtal::DiscreteExteriorCalculus<2, 2, DGtal::EigenLinearAlgebraBackend> Calculus;
+    typedef DGtal::MatrixFreeOperatorFactory<Calculus> MatrixFreeFactory;
+    typedef DGtal::Z2i::Point Point;
+
+    DGtal::trace.beginBlock("testing matrix free solvers");
+
+    const DGtal::Z2i::Domain domain(Point(0,0), Point(29,29));
+    DGtal::Z2i::DigitalSet set(domain);
+    for (DGtal::Z2i::Domain::ConstIterator di=domain.begin(), die=domain.end(); di!=die; di++)
+        if ((*di - Point(15,15)).norm() < 13) set.insertNew(*di);
+    const Calculus calculus = CalculusFactory::createFromDigitalSet(set, false);
+
+    {
+        DGtal::trace.info() << "dual laplace with conjugate gradient" << std::endl;
+
+        typedef DGtal::MatrixFreeLinearOperator<Calculus, 0, DGtal::DUAL, 0, DGtal::DUAL> MatrixFreeOperator;
+        const MatrixFreeOperator matrix_free_laplace = MatrixFreeFactory::laplace<DGtal::DUAL>(calculus) + .01 * MatrixFreeFactory::identity<0, DGtal::DUAL>(calculus);
+        const Calculus::DualIdentity0 laplace = calculus.laplace<DGtal::DUAL>() + .01 * calculus.identity<0, DGtal::DUAL>();
+
+        Calculus::DualForm0 dirac(calculus);
+        dirac.myContainer(calculus.getCellIndex(calculus.myKSpace.uSpel(Point(15,15)))) = 1;
+
+        typedef DGtal::DiscreteExteriorCalculusSolver<Calculus, MatrixFreeOperator::SolverConjugateGradient, 0, DGtal::DUAL, 0, DGtal::DUAL> MatrixFreeSolver;
+        MatrixFreeSolver matrix_free_solver;
+        matrix_free_solver.myLinearAlgebraSolver.setTolerance(1e-12);
+        matrix_free_solver.compute(matrix_free_laplace);
+        const Calculus::DualForm0 solution = matrix_free_solver.solve(dirac);
+        DGtal::trace.info() << "iterations=" << matrix_free_solver.myLinearAlgebraSolver.iterations() << std::endl;
+        FATAL_ERROR( matrix_free_solver.isValid() );
+
+        typedef DGtal::DiscreteExteriorCalculusSolver<Calculus, DGtal::EigenLinearAlgebraBackend::SolverSimplicialLLT, 0, DGtal::DUAL, 0, DGtal::DUAL> Solver;
+        Solver solver;
+        solver.compute(laplace);
+        const Calculus::DualForm0 solution_reference = solver.solve(dirac);
+        FATAL_ERROR( solver.isValid() );
+
+        const double difference = max_difference(solution.myContainer, solution_reference.myContainer);
+        DGtal::trace.info() << "difference=" << difference << std::endl;
+        FATAL_ERROR( difference < 1e-6 * solution_reference.myContainer.cwiseAbs().maxCoeff() );
+        DGtal::trace.info() << "matrix_free_entries=" << matrix_free_laplace.nbStoredEntries() << " sparse_entries=" << laplace.myContainer.nonZeros() << std::endl;
+    }
+
+    {
+        DGtal::trace.info() << "primal heat step with biconjugate gradient stabilized" << std::endl;
+
+        typedef DGtal::MatrixFreeLinearOperator<Calculus, 0, DGtal::PRIMAL, 0, DGtal::PRIMAL> MatrixFreeOperator;
+        const MatrixFreeOperator matrix_free_heat = MatrixFreeFactory::identity<0, DGtal::PRIMAL>(calculus) + .5 * MatrixFreeFactory::laplace<DGtal::PRIMAL>(calculus);
+        const Calculus::PrimalIdentity0 heat = calculus.identity<0, DGtal::PRIMAL>() + .5 * calculus.laplace<DGtal::PRIMAL>();
+
+        Calculus::PrimalForm0 input(calculus);
+        for (Calculus::Index ii=0; ii<input.length(); ii++)
+            input.myContainer(ii) = static_cast<double>(std::rand())/RAND_MAX;
+
+        MatrixFreeOperator::SolverBiCGSTAB matrix_free_solver;
+        matrix_free_solver.setTolerance(1e-12);
+        matrix_free_solver.compute(matrix_free_heat);
+        const Calculus::DenseVector solution = matrix_free_solver.solve(input.myContainer);
+        DGtal::trace.info() << "iterations=" << matrix_free_solver.iterations() << std::endl;
+        FATAL_ERROR( matrix_free_solver.info() == Eigen::Success );
+
+        DGtal::EigenLinearAlgebraBackend::SolverSparseLU solver;
+        solver.compute(heat.myContainer);
+        const Calculus::DenseVector solution_reference = solver.solve(input.myContainer);
+
+        const double difference = max_difference(solution, solution_reference);
+        DGtal::trace.info() << "difference=" << difference << std::endl;
+        FATAL_ERROR( difference < 1e-8 );
+    }
+
+    DGtal::trace.endBlock();
+}
+
+int
+main(int /*argc*/, char** /*argv*/)
+{
+    test_operators<DGtal::Z2i::DigitalSet>(12);
+    test_operators<DGtal::Z3i::DigitalSet>(8);
+    test_solvers();
+
+    return 0;
+}
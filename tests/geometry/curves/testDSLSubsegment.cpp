@@ -32,6 +32,9 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <map>
+#include <vector>
+#include <algorithm>
+#include <random>
 #include "DGtal/geometry/curves/DSLSubsegment.h"
 #include "DGtal/arithmetic/StandardDSLQ0.h"
 #include "DGtal/kernel/CPointPredicate.h"
@@ -202,6 +205,69 @@ bool testDSLSubsegment(Integer modb)
 }
 
 
+/**
+ * Compares the batch computation of subsegments with the one-by-one
+ * computation, for all the subsegments of a few DSLs, given in a
+ * random order.
+ * @param modb bound on the b parameter of the DSLs
+ * @param chunkSize maximal number of queries processed at once
+ */
+template <typename Integer>
+bool testDSLSubsegmentBatch(DGtal::int64_t modb, std::size_t chunkSize)
+{
+  typedef DGtal::DSLSubsegment<Integer,Integer> DSLSubseg;
+  typedef typename DSLSubseg::Point Point;
+  typedef typename DSLSubseg::Query Query;
+  typedef typename DSLSubseg::Characteristics Characteristics;
+
+  DGtal::IntegerComputer<Integer> ic;
+  std::vector<Query> queries;
+  const unsigned int l = 60; // max length of the DSSs
+
+  trace.beginBlock("Compare batch DSLSubsegment with one-by-one DSLSubsegment");
+  for(unsigned int k = 0; k < 5; k++)
+    {
+      Integer b( rand() % modb +1);
+      Integer a( rand() % b +1);
+      while(ic.gcd(a,b) !=1)
+        a = rand() % b +1;
+      Integer mu( rand() % (2*modb) );
+      Integer xf( rand() % modb );
+      for(unsigned int i = 0; i<l; i++)
+        for(unsigned int j = i+1; j<l; j++)
+          {
+            Integer x1 = xf+i;
+            Integer x2 = xf+j;
+            Query q;
+            q.a = a;
+            q.b = b;
+            q.mu = mu;
+            q.A = Point(x1,ic.floorDiv(a*x1+mu,b));
+            q.B = Point(x2,ic.floorDiv(a*x2+mu,b));
+            queries.push_back(q);
+          }
+    }
+  std::mt19937 engine( 42 );
+  std::shuffle(queries.begin(), queries.end(), engine);
+
+  std::vector<Characteristics> results;
+  DSLSubseg::computeBatch(queries, results, chunkSize);
+
+  int error = ( results.size() == queries.size() ) ? 0 : 1;
+  for(unsigned int i = 0; error == 0 && i < queries.size(); i++)
+    {
+      Query q = queries[i];
+      DSLSubseg DSLsub(q.a,q.b,q.mu,q.A,q.B,"farey");
+      if(DSLsub.getA() != results[i][0] || DSLsub.getB() != results[i][1] || DSLsub.getMu() != results[i][2])
+        error ++;
+    }
+  trace.info() << queries.size() << " queries, " << error << " errors." << std::endl;
+  trace.endBlock();
+  trace.info() << std::endl;
+
+  return error==0;
+}
+
 
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
@@ -218,7 +284,12 @@ int main()
   Integer i = 1000;
   srand(time(NULL));
   
-  bool res = testDSLSubsegment<Integer,Fraction>(i);
+  bool res = testDSLSubsegment<Integer,Fraction>(i)
+    && testDSLSubsegmentBatch<Integer>(i, 1024)
+    && testDSLSubsegmentBatch<Integer>(i, 7);
+#ifdef WITH_BIGINTEGER
+  res = res && testDSLSubsegmentBatch<DGtal::BigInteger>(i, 1024);
+#endif
   
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
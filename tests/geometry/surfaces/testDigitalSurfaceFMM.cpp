@@ -0,0 +1,299 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDigitalSurfaceFMM.cpp
+ * @ingroup Tests
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class DigitalSurfaceFMM.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <cmath>
+#include <algorithm>
+#include <functional>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/topology/CanonicSCellEmbedder.h"
+#include "DGtal/geometry/surfaces/DigitalSurfaceFMM.h"
+#include "DGtal/shapes/Shapes.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DigitalSurfaceFMM.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef DigitalSetBoundary<KSpace,DigitalSet> Container;
+typedef DigitalSurface<Container> Surface;
+typedef DigitalSurfaceFMM<Container> FMM;
+typedef FMM::Frozen Frozen;
+typedef FMM::Indexed Indexed;
+typedef FMM::Vertex Vertex;
+typedef FMM::Scalar Scalar;
+
+/**
+ * Graph distances along arcs (Dijkstra), for comparison.
+ */
+std::vector<Scalar> graphDistances( const FMM & fmm, const Frozen & frozen,
+                                    Vertex source )
+{
+  typedef std::pair<Scalar,Vertex> Node;
+  std::vector<Scalar> d( frozen.size(), FMM::infinity() );
+  std::priority_queue< Node, std::vector<Node>, std::greater<Node> > q;
+  d[ source ] = 0.0;
+  q.push( Node( 0.0, source ) );
+  while ( ! q.empty() )
+    {
+      Node n = q.top();
+      q.pop();
+      if ( n.first != d[ n.second ] ) continue;
+      Frozen::IndexRange nbrs = frozen.neighbors( n.second );
+      for ( ; nbrs.first != nbrs.second; ++nbrs.first )
+        {
+          Vertex u = *nbrs.first;
+          Scalar du = n.first
+            + ( fmm.position( u ) - fmm.position( n.second ) ).norm();
+          if ( du < d[ u ] )
+            {
+              d[ u ] = du;
+              q.push( Node( du, u ) );
+            }
+        }
+    }
+  return d;
+}
+
+/// Embeds surfels on the sphere of radius R centered at the origin.
+struct SphereEmbedder
+{
+  SphereEmbedder( const KSpace & K, Scalar R ) : myEmbedder( K ), myRadius( R ) {}
+  RealPoint operator()( const SCell & s ) const
+  {
+    RealPoint p = myEmbedder( s );
+    return p * ( myRadius / p.norm() );
+  }
+  CanonicSCellEmbedder<KSpace> myEmbedder;
+  Scalar myRadius;
+};
+
+/// @return the angle between the two points, seen from the origin.
+Scalar angle( const RealPoint & p, const RealPoint & q )
+{
+  Scalar c = p.dot( q ) / ( p.norm() * q.norm() );
+  return std::acos( std::max( -1.0, std::min( 1.0, c ) ) );
+}
+
+/// @return the maximal difference between two distance fields.
+Scalar maxDifference( const std::vector<Scalar> & d1,
+                      const std::vector<Scalar> & d2 )
+{
+  Scalar m = 0.0;
+  for ( unsigned int i = 0; i < d1.size(); ++i )
+    {
+      if ( d1[ i ] == d2[ i ] ) continue; // handles infinity
+      m = std::max( m, std::abs( d1[ i ] - d2[ i ] ) );
+    }
+  return m;
+}
+
+/**
+ * Geodesic distances on a digital sphere, compared with the
+ * great-circle distances.
+ */
+bool testDigitalSurfaceFMM()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing DigitalSurfaceFMM on a sphere..." );
+  const int R = 12;
+  Point p1( -R-2, -R-2, -R-2 );
+  Point p2( R+2, R+2, R+2 );
+  Domain domain( p1, p2 );
+  DigitalSet set( domain );
+  Shapes<Domain>::addNorm2Ball( set, Point( 0, 0, 0 ), R );
+  KSpace K;
+  K.init( p1, p2, true );
+  Surface surface( new Container( K, set ) );
+  Frozen frozen( surface );
+  Indexed indexed;
+  indexed.init( surface );
+  CanonicSCellEmbedder<KSpace> embedder( K );
+  FMM fmm;
+  fmm.init( frozen, embedder );
+  trace.info() << fmm << std::endl;
+  nbok += fmm.isValid() ? 1 : 0;
+  nb++;
+
+  // Source: the highest surfel, and its opposite.
+  std::vector<Vertex> sources( 2, 0 );
+  for ( Vertex v = 0; v < fmm.nbVertices(); ++v )
+    {
+      if ( fmm.position( v )[ 2 ] > fmm.position( sources[ 0 ] )[ 2 ] )
+        sources[ 0 ] = v;
+      if ( fmm.position( v )[ 2 ] < fmm.position( sources[ 1 ] )[ 2 ] )
+        sources[ 1 ] = v;
+    }
+  fmm.compute( sources.begin(), sources.begin() + 1 );
+  std::vector<Scalar> sequential = fmm.distances();
+  std::vector<Scalar> dijkstra = graphDistances( fmm, frozen, sources[ 0 ] );
+  Scalar errFMM = 0.0;
+  Scalar errGraph = 0.0;
+  unsigned int n = 0;
+  bool reached = true;
+  for ( Vertex v = 0; v < fmm.nbVertices(); ++v )
+    {
+      reached = reached && fmm.isReached( v ) && fmm.label( v ) == 0;
+      Scalar exact = R * angle( fmm.position( v ), fmm.position( sources[ 0 ] ) );
+      if ( exact < R / 2 ) continue;
+      errFMM += std::abs( sequential[ v ] - exact ) / exact;
+      errGraph += std::abs( dijkstra[ v ] - exact ) / exact;
+      ++n;
+    }
+  errFMM /= n;
+  errGraph /= n;
+  trace.info() << "mean relative error FMM=" << errFMM
+               << " graph=" << errGraph << std::endl;
+  nbok += reached ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "all vertices are reached" << std::endl;
+  nbok += ( errFMM < errGraph ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "FMM is closer to the geodesic distance than graph distances"
+               << std::endl;
+
+  // With surfels projected onto the sphere, the FMM is accurate.
+  FMM sfmm;
+  sfmm.init( frozen, SphereEmbedder( K, R ) );
+  sfmm.compute( sources.begin(), sources.begin() + 1 );
+  Scalar errSphere = 0.0;
+  for ( Vertex v = 0; v < sfmm.nbVertices(); ++v )
+    {
+      Scalar exact = R * angle( sfmm.position( v ), sfmm.position( sources[ 0 ] ) );
+      if ( exact < R / 2 ) continue;
+      errSphere += std::abs( sfmm.distance( v ) - exact ) / exact;
+    }
+  errSphere /= n;
+  nbok += ( errSphere < 0.04 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "mean relative error with surfels on the sphere="
+               << errSphere << std::endl;
+
+  fmm.parallelCompute( sources.begin(), sources.begin() + 1 );
+  Scalar diff = maxDifference( sequential, fmm.distances() );
+  nbok += ( diff < 1e-9 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "parallelCompute == compute, diff=" << diff << std::endl;
+
+  FMM ifmm;
+  ifmm.init( indexed, embedder );
+  ifmm.compute( sources.begin(), sources.begin() + 1 );
+  diff = maxDifference( sequential, ifmm.distances() );
+  nbok += ( diff < 1e-9 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "IndexedDigitalSurface == FrozenDigitalSurface, diff="
+               << diff << std::endl;
+
+  // Two sources: geodesic Voronoi diagram.
+  fmm.compute( sources.begin(), sources.end() );
+  std::vector<FMM::Index> labels = fmm.labels();
+  sequential = fmm.distances();
+  bool voronoi = fmm.nbSources() == 2;
+  for ( Vertex v = 0; v < fmm.nbVertices(); ++v )
+    {
+      Scalar z = fmm.position( v )[ 2 ];
+      if ( std::abs( z ) > 2.0 )
+        voronoi = voronoi && ( labels[ v ] == ( z > 0 ? 0 : 1 ) );
+    }
+  nbok += voronoi ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "two sources give the two hemispheres" << std::endl;
+  fmm.parallelCompute( sources.begin(), sources.end() );
+  unsigned int nbDiffLabels = 0;
+  for ( Vertex v = 0; v < fmm.nbVertices(); ++v )
+    nbDiffLabels += ( labels[ v ] != fmm.label( v ) ) ? 1 : 0;
+  diff = maxDifference( sequential, fmm.distances() );
+  nbok += ( diff < 1e-9 && nbDiffLabels * 100 < fmm.nbVertices() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "parallelCompute == compute with two sources, diff="
+               << diff << " #labels differing=" << nbDiffLabels << std::endl;
+
+  // Geodesic patch.
+  const Scalar r = 6.0;
+  fmm.compute( sources.begin(), sources.begin() + 1 );
+  sequential = fmm.distances();
+  fmm.compute( sources.begin(), sources.begin() + 1, r );
+  std::vector<Scalar> patch = fmm.distances();
+  fmm.parallelCompute( sources.begin(), sources.begin() + 1, r );
+  bool patchOk = maxDifference( patch, fmm.distances() ) < 1e-9;
+  unsigned int nbPatch = 0;
+  for ( Vertex v = 0; v < fmm.nbVertices(); ++v )
+    {
+      if ( sequential[ v ] <= r )
+        patchOk = patchOk && fmm.isReached( v ) && patch[ v ] == sequential[ v ];
+      else
+        patchOk = patchOk && ! fmm.isReached( v )
+          && patch[ v ] == FMM::infinity();
+      nbPatch += fmm.isReached( v ) ? 1 : 0;
+    }
+  nbok += patchOk ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "geodesic patch of radius " << r << ", #vertices="
+               << nbPatch << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class DigitalSurfaceFMM" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testDigitalSurfaceFMM();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
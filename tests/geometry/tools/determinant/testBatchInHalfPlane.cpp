@@ -0,0 +1,196 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBatchInHalfPlane.cpp
+ * @ingroup Tests
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class BatchInHalfPlaneBy2x2DetComputer.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+
+#include "DGtal/geometry/tools/determinant/AvnaimEtAl2x2DetSignComputer.h"
+#include "DGtal/geometry/tools/determinant/Simple2x2DetComputer.h"
+
+#include "DGtal/geometry/tools/determinant/COrientationFunctor2.h"
+#include "DGtal/geometry/tools/determinant/InHalfPlaneBy2x2DetComputer.h"
+#include "DGtal/geometry/tools/determinant/BatchInHalfPlaneBy2x2DetComputer.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class BatchInHalfPlaneBy2x2DetComputer.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Returns the sign of @a v
+ * @param v any value
+ * @return -1, 0 or 1
+ */
+template <typename Value>
+int sign( const Value& v )
+{
+  return ( v > 0 ) ? 1 : ( ( v < 0 ) ? -1 : 0 );
+}
+
+/**
+ * Compares the batch operators to InHalfPlaneBy2x2DetComputer on
+ * random points and on (nearly) collinear points with large coordinates.
+ * @param maxCoordinate bound on the coordinates
+ */
+bool testBatchInHalfPlane( DGtal::int64_t maxCoordinate )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef PointVector<2, DGtal::int64_t> Point;
+  typedef AvnaimEtAl2x2DetSignComputer<DGtal::int64_t> DetComputer;
+  typedef InHalfPlaneBy2x2DetComputer<Point, DetComputer> Reference;
+  typedef BatchInHalfPlaneBy2x2DetComputer<Point, DetComputer> Functor;
+  BOOST_CONCEPT_ASSERT(( concepts::COrientationFunctor2<Functor> ));
+  typedef Functor::Value Value;
+
+  trace.beginBlock ( "Batch orientation vs one-by-one orientation..." );
+  trace.info() << "max coordinate: " << maxCoordinate << endl;
+
+  srand( 0 );
+  const DGtal::int64_t r = maxCoordinate / 1024;
+  Point p( 0, 0 );
+  Point q( 1021 * r, 1019 * r );
+  std::vector<Point> points;
+  for ( unsigned int i = 0; i < 1000; ++i )
+    { //random points
+      points.push_back( Point( ( rand() % 2049 - 1024 ) * r + rand() % 1000,
+                               ( rand() % 2049 - 1024 ) * r + rand() % 1000 ) );
+    }
+  for ( DGtal::int64_t k = -500; k < 500; ++k )
+    { //collinear and nearly collinear points
+      Point c( 1021 * ( r / 1024 ) * k, 1019 * ( r / 1024 ) * k );
+      points.push_back( c );
+      points.push_back( c + Point( 0, 1 ) );
+      points.push_back( c - Point( 1, 0 ) );
+    }
+  for ( DGtal::int64_t k = -5; k < 5; ++k )
+    points.push_back( p + ( q - p ) * k );
+
+  Reference ref;
+  ref.init( p, q );
+  Functor f;
+  f.init( p, q );
+  trace.info() << f << endl;
+
+  std::vector<Value> res;
+  f( points.begin(), points.end(), std::back_inserter( res ) );
+  nb++;
+  if ( res.size() == points.size() )
+    nbok++;
+  for ( unsigned int i = 0; i < points.size(); ++i )
+    {
+      nb++;
+      if ( sign( res[i] ) == sign( ref( points[i] ) ) && ( res[i] == sign( res[i] ) ) )
+        nbok++;
+      nb++;
+      if ( f( points[i] ) == res[i] )
+        nbok++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << f.nbExactEvaluations() << " exact evaluations" << endl;
+
+  //many lines
+  std::vector<Point> ps( points.size(), p ), qs( points.size(), q );
+  std::vector<Value> res2;
+  f( ps.begin(), ps.end(), qs.begin(), points.begin(), std::back_inserter( res2 ) );
+  nb++;
+  if ( res2 == res )
+    nbok++;
+  std::vector<Value> res3;
+  f( points.begin(), points.end(), ps.begin(), qs.begin(), std::back_inserter( res3 ) );
+  nb++;
+  if ( res3 == res )
+    nbok++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Basic orientation tests with a simple exact computer.
+ */
+bool testBasicOrientation()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef PointVector<2, DGtal::int16_t> Point;
+  typedef Simple2x2DetComputer<DGtal::int32_t, DGtal::int64_t> DetComputer;
+  typedef BatchInHalfPlaneBy2x2DetComputer<Point, DetComputer> Functor;
+  typedef Functor::Value Value;
+
+  trace.beginBlock ( "Basic orientation..." );
+  Functor f;
+  f.init( Point(0,0), Point(5,2) );
+  if ( f( Point(2,1) ) == NumberTraits<Value>::ONE )
+    nbok++;   //a, b, (2,1) are CCW oriented
+  nb++;
+  if ( f( Point(3,1) ) == -NumberTraits<Value>::ONE )
+    nbok++;   //a, b, (3,1) are CW oriented
+  nb++;
+  if ( f( Point(10,4) ) == NumberTraits<Value>::ZERO )
+    nbok++;   //a, b, (10,4) belong to the same line
+  nb++;
+  if ( f.nbExactEvaluations() == 1 )
+    nbok++;   //only the last test required an exact computation
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class BatchInHalfPlaneBy2x2DetComputer" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testBasicOrientation()
+    && testBatchInHalfPlane( 1 << 20 )
+    && testBatchInHalfPlane( DGtal::int64_t(1) << 30 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
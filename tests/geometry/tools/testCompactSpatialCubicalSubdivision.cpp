@@ -0,0 +1,181 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testCompactSpatialCubicalSubdivision.cpp
+ * @ingroup Tests
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class CompactSpatialCubicalSubdivision.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/tools/SpatialCubicalSubdivision.h"
+#include "DGtal/geometry/tools/CompactSpatialCubicalSubdivision.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class CompactSpatialCubicalSubdivision.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef CompactSpatialCubicalSubdivision<Space> Subdivision;
+
+/// Collects the indices of the visited points.
+struct IndexCollector
+{
+  std::vector<Subdivision::Index>* indices;
+  void operator()( const Point&, Subdivision::Index i ) const
+  {
+    indices->push_back( i );
+  }
+};
+
+/// @return the squared euclidean distance between p and q.
+double distance2( const Point& p, const Point& q )
+{
+  Point v = p - q;
+  return (double) v.dot( v );
+}
+
+/**
+ * Compares the compact subdivision with SpatialCubicalSubdivision and
+ * with brute-force radius and k-nearest neighbors queries.
+ */
+bool testCompactSpatialCubicalSubdivision()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing CompactSpatialCubicalSubdivision..." );
+  srand( 0 );
+  Point lo( -20, -10, 0 );
+  Point up( 30, 17, 23 );
+  std::vector<Point> pts;
+  for ( unsigned int i = 0; i < 2000; ++i )
+    pts.push_back( Point( lo[0] + rand() % ( up[0] - lo[0] + 1 ),
+                          lo[1] + rand() % ( up[1] - lo[1] + 1 ),
+                          lo[2] + rand() % ( up[2] - lo[2] + 1 ) ) );
+  pts.push_back( pts[ 10 ] ); // duplicated point
+
+  Subdivision sub( lo, up, 4 );
+  sub.init( pts.begin(), pts.end() );
+  SpatialCubicalSubdivision<Space> ref( lo, up, 4 );
+  ref.push( pts.begin(), pts.end() );
+  trace.info() << sub << std::endl;
+  nb++;
+  if ( sub.isValid() && sub.size() == pts.size()
+       && sub.binDomain().upperBound() == ref.binDomain().upperBound() )
+    nbok++;
+
+  // Same points per bin, in the same order.
+  bool same = true;
+  for ( Domain::ConstIterator it = sub.binDomain().begin(), itE = sub.binDomain().end();
+        same && it != itE; ++it )
+    {
+      std::vector<Point> refPts;
+      ref.getPoints( refPts, *it, *it );
+      Subdivision::IndexRange range = sub.binRange( *it );
+      same = ( refPts.size() == range.second - range.first )
+        && std::equal( refPts.begin(), refPts.end(), sub.points().begin() + range.first );
+      for ( Subdivision::Index j = range.first; same && j < range.second; ++j )
+        same = pts[ sub.indices()[ j ] ] == sub.points()[ j ];
+    }
+  nb++;
+  if ( same ) nbok++;
+  trace.info() << "(" << nbok << "/" << nb << ") bins" << std::endl;
+
+  // Radius queries.
+  bool radiusOk = true;
+  for ( unsigned int i = 0; radiusOk && i < 100; ++i )
+    {
+      Point p = pts[ rand() % pts.size() ];
+      double radius = 1.0 + ( rand() % 80 ) / 10.0;
+      std::vector<Subdivision::Index> found;
+      IndexCollector collector = { &found };
+      sub.forEachNeighbor( p, radius, collector );
+      std::sort( found.begin(), found.end() );
+      std::vector<Subdivision::Index> expected;
+      for ( Subdivision::Index j = 0; j < pts.size(); ++j )
+        if ( distance2( p, pts[ j ] ) <= radius * radius ) expected.push_back( j );
+      radiusOk = found == expected;
+    }
+  nb++;
+  if ( radiusOk ) nbok++;
+  trace.info() << "(" << nbok << "/" << nb << ") radius queries" << std::endl;
+
+  // k-nearest neighbors.
+  std::vector<Point> queries;
+  for ( unsigned int i = 0; i < 200; ++i )
+    queries.push_back( Point( lo[0] + rand() % ( up[0] - lo[0] + 1 ),
+                              lo[1] + rand() % ( up[1] - lo[1] + 1 ),
+                              lo[2] + rand() % ( up[2] - lo[2] + 1 ) ) );
+  bool knnOk = true;
+  const Subdivision::Index ks[] = { 1, 7, 50, 3000 };
+  for ( unsigned int n = 0; n < 4; ++n )
+    {
+      std::vector< std::vector<Subdivision::Index> > result;
+      sub.kNearestNeighbors( queries, ks[ n ], result );
+      for ( unsigned int i = 0; knnOk && i < queries.size(); ++i )
+        {
+          std::vector< std::pair<double,Subdivision::Index> > all;
+          for ( Subdivision::Index j = 0; j < pts.size(); ++j )
+            all.push_back( std::make_pair( distance2( queries[ i ], pts[ j ] ), j ) );
+          std::sort( all.begin(), all.end() );
+          all.resize( std::min( (std::size_t) ks[ n ], all.size() ) );
+          knnOk = result[ i ].size() == all.size();
+          for ( unsigned int j = 0; knnOk && j < all.size(); ++j )
+            knnOk = result[ i ][ j ] == all[ j ].second;
+        }
+    }
+  nb++;
+  if ( knnOk ) nbok++;
+  trace.info() << "(" << nbok << "/" << nb << ") k-nearest neighbors" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class CompactSpatialCubicalSubdivision" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testCompactSpatialCubicalSubdivision();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
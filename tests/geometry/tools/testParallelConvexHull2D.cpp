@@ -0,0 +1,182 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testParallelConvexHull2D.cpp
+ * @ingroup Tests
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing the parallel and streaming convex hull computations.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/tools/Hull2DHelpers.h"
+#include "DGtal/geometry/tools/StreamingConvexHull.h"
+#include "DGtal/geometry/tools/determinant/InHalfPlaneBySimple3x3Matrix.h"
+#include "DGtal/geometry/tools/determinant/BatchInHalfPlaneBy2x2DetComputer.h"
+#include "DGtal/geometry/tools/determinant/AvnaimEtAl2x2DetSignComputer.h"
+#include "DGtal/geometry/tools/determinant/PredicateFromOrientationFunctor2.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing the parallel and streaming convex hull computations.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Compares Hull2D::parallelConvexHullAlgorithm and StreamingConvexHull
+ * to Hull2D::andrewConvexHullAlgorithm.
+ * @param data input points
+ * @param aFunctor an orientation functor
+ * @return 'true' if passed.
+ */
+template <typename Point, typename Functor>
+bool compareToAndrew( const std::vector<Point>& data, Functor aFunctor )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  std::vector<Point> ref, res, filtered;
+  PredicateFromOrientationFunctor2<Functor> predicate( aFunctor );
+  functions::Hull2D::andrewConvexHullAlgorithm( data.begin(), data.end(),
+                                                std::back_inserter( ref ), predicate );
+
+  functions::Hull2D::aklToussaintFilter( data.begin(), data.end(),
+                                         std::back_inserter( filtered ), aFunctor );
+  trace.info() << data.size() << " points, " << filtered.size()
+               << " after filtering, " << ref.size() << " vertices" << std::endl;
+  res.clear();
+  functions::Hull2D::andrewConvexHullAlgorithm( filtered.begin(), filtered.end(),
+                                                std::back_inserter( res ), predicate );
+  if ( res == ref )
+    nbok++;
+  nb++;
+
+  res.clear();
+  functions::Hull2D::parallelConvexHullAlgorithm( data.begin(), data.end(),
+                                                  std::back_inserter( res ), aFunctor, 1000 );
+  if ( res == ref )
+    nbok++;
+  nb++;
+
+  res.clear();
+  functions::Hull2D::parallelConvexHullAlgorithm( data.begin(), data.end(),
+                                                  std::back_inserter( res ), aFunctor );
+  if ( res == ref )
+    nbok++;
+  nb++;
+
+  StreamingConvexHull<Point, Functor> hull( aFunctor, 100 );
+  for ( std::size_t i = 0; i < data.size(); i += 777 )
+    hull.add( data.begin() + i, data.begin() + std::min( data.size(), i + 777 ) );
+  trace.info() << hull << std::endl;
+  if ( std::equal( ref.begin(), ref.end(), hull.begin() ) && ( ref.size() == hull.size() )
+       && ( hull.nbPoints() == data.size() ) && hull.isValid() )
+    nbok++;
+  nb++;
+
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  return nbok == nb;
+}
+
+/**
+ * Testing the parallel and streaming convex hull computations
+ * on random and degenerated sets.
+ * @return 'true' if passed.
+ */
+bool testParallelConvexHull2D()
+{
+  typedef PointVector<2,DGtal::int64_t> Point;
+  typedef InHalfPlaneBySimple3x3Matrix<Point, DGtal::int64_t> Functor1;
+  typedef BatchInHalfPlaneBy2x2DetComputer<Point, AvnaimEtAl2x2DetSignComputer<DGtal::int64_t> > Functor2;
+
+  bool res = true;
+  srand( 0 );
+
+  trace.beginBlock ( "Random points in a disk..." );
+  std::vector<Point> data;
+  while ( data.size() < 50000 )
+    {
+      Point p( rand() % 20001 - 10000, rand() % 20001 - 10000 );
+      if ( p[0]*p[0] + p[1]*p[1] <= 100000000 )
+        data.push_back( p );
+    }
+  res = res && compareToAndrew( data, Functor1() ) && compareToAndrew( data, Functor2() );
+  trace.endBlock();
+
+  trace.beginBlock ( "Random points in a square..." );
+  data.clear();
+  for ( unsigned int i = 0; i < 50000; ++i )
+    data.push_back( Point( rand() % 1001, rand() % 1001 ) );
+  res = res && compareToAndrew( data, Functor1() ) && compareToAndrew( data, Functor2() );
+  trace.endBlock();
+
+  trace.beginBlock ( "Collinear points..." );
+  data.clear();
+  for ( unsigned int i = 0; i < 5000; ++i )
+    data.push_back( Point( 3, 2 ) * ( rand() % 1000 ) );
+  res = res && compareToAndrew( data, Functor1() ) && compareToAndrew( data, Functor2() );
+  trace.endBlock();
+
+  trace.beginBlock ( "Identical points..." );
+  data.assign( 3000, Point( 5, 7 ) );
+  std::vector<Point> ref, hull;
+  Functor1 functor;
+  PredicateFromOrientationFunctor2<Functor1> predicate( functor );
+  functions::Hull2D::andrewConvexHullAlgorithm( data.begin(), data.end(),
+                                                std::back_inserter( ref ), predicate );
+  functions::Hull2D::parallelConvexHullAlgorithm( data.begin(), data.end(),
+                                                  std::back_inserter( hull ), functor, 100 );
+  StreamingConvexHull<Point, Functor1> streamingHull;
+  streamingHull.add( data.begin(), data.end() );
+  streamingHull.add( data.begin(), data.begin() );
+  trace.info() << streamingHull << std::endl;
+  res = res && ( hull == ref ) && ( streamingHull.size() == 1 ) && ( streamingHull[0] == data[0] );
+  trace.endBlock();
+
+  return res;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing parallel and streaming convex hull computations" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testParallelConvexHull2D();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,241 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testQuickHull3D.cpp
+ * @ingroup Tests
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class QuickHull3D.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/tools/QuickHull3D.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class QuickHull3D.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Convex hull of a digital cube, with points in the middle of its
+ * faces and inside.
+ */
+bool testCube()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Convex hull of a cube..." );
+  Domain domain( Point( 0, 0, 0 ), Point( 10, 10, 10 ) );
+  std::vector<Point> points( domain.begin(), domain.end() );
+
+  QuickHull3D<Space> hull;
+  nb++;
+  if ( hull.compute( points.begin(), points.end() ) )
+    nbok++;
+  trace.info() << hull << endl;
+  nb++;
+  if ( hull.nbCandidatePoints() == 2 * 11 * 11 )
+    nbok++;   //only the extremities of the rows are kept
+  nb++;
+  if ( hull.nbVertices() == 8 )
+    nbok++;
+  nb++;
+  if ( hull.nbFacets() == 6 )
+    nbok++;
+  nb++;
+  if ( hull.triangles().size() == 12 )
+    nbok++;
+  for ( std::size_t i = 0; i < hull.facets().size(); ++i )
+    {
+      const QuickHull3D<Space>::Facet& f = hull.facets()[ i ];
+      nb++;
+      if ( ( f.vertices.size() == 4 )
+           && ( std::abs( f.normal[0] ) + std::abs( f.normal[1] ) + std::abs( f.normal[2] ) == 1 ) )
+        nbok++;
+    }
+  nb++;
+  if ( hull.nbLatticePoints() == 11 * 11 * 11 )
+    nbok++;
+  nb++;
+  if ( hull.isInside( Point( 10, 10, 10 ) ) && ! hull.isInside( Point( 11, 5, 5 ) ) )
+    nbok++;
+  nb++;
+  if ( hull.isValid() )
+    nbok++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Convex hull of random points, checked against the brute-force
+ * inclusion test and the digitization of the hull.
+ * @param nbPoints number of random points
+ * @param radius bound on the coordinates
+ */
+bool testRandomPoints( unsigned int nbPoints, int radius )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Convex hull of random points..." );
+  srand( 0 );
+  std::vector<Point> points;
+  for ( unsigned int i = 0; i < nbPoints; ++i )
+    points.push_back( Point( rand() % ( 2 * radius + 1 ) - radius,
+                             rand() % ( 2 * radius + 1 ) - radius,
+                             rand() % ( 2 * radius + 1 ) - radius ) );
+
+  QuickHull3D<Space> hull;
+  hull.compute( points.begin(), points.end() );
+  trace.info() << hull << endl;
+  nb++;
+  if ( hull.isValid() )
+    nbok++;
+
+  //every input point lies in the convex hull
+  bool inside = true;
+  for ( std::size_t i = 0; i < points.size(); ++i )
+    inside = inside && hull.isInside( points[ i ] );
+  nb++;
+  if ( inside )
+    nbok++;
+
+  //every vertex is an input point and lies on three facets at least
+  bool extremal = true;
+  for ( std::size_t i = 0; i < hull.nbVertices(); ++i )
+    {
+      unsigned int n = 0;
+      for ( std::size_t j = 0; j < hull.nbFacets(); ++j )
+        if ( std::find( hull.facets()[ j ].vertices.begin(),
+                        hull.facets()[ j ].vertices.end(), i ) != hull.facets()[ j ].vertices.end() )
+          n++;
+      extremal = extremal && ( n >= 3 )
+        && ( std::find( points.begin(), points.end(), hull.vertices()[ i ] ) != points.end() );
+    }
+  nb++;
+  if ( extremal )
+    nbok++;
+
+  //row digitization vs brute force
+  Domain domain( Point::diagonal( -radius - 2 ), Point::diagonal( radius + 2 ) );
+  DigitalSet set( domain );
+  hull.digitizeInterior( set );
+  unsigned int nbErrors = 0;
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( set( *it ) != hull.isInside( *it ) )
+      nbErrors++;
+  nb++;
+  if ( ( nbErrors == 0 ) && ( set.size() == hull.nbLatticePoints() ) )
+    nbok++;
+  trace.info() << set.size() << " lattice points, " << nbErrors << " errors" << endl;
+
+  //digitization restricted to a smaller domain
+  Domain subDomain( Point( 0, -radius, 1 ), Point( radius, 0, radius ) );
+  DigitalSet subSet( subDomain );
+  hull.digitizeInterior( subSet );
+  unsigned int n = 0;
+  for ( Domain::ConstIterator it = subDomain.begin(); it != subDomain.end(); ++it )
+    if ( set( *it ) )
+      n++;
+  nb++;
+  if ( n == subSet.size() )
+    nbok++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Degenerate inputs: coplanar points and large coordinates.
+ */
+bool testDegenerateCases()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Degenerate cases..." );
+  std::vector<Point> points;
+  QuickHull3D<Space> hull;
+  nb++;
+  if ( ! hull.compute( points.begin(), points.end() ) && hull.nbVertices() == 0 )
+    nbok++;   //empty input
+
+  for ( int i = 0; i < 10; ++i )
+    for ( int j = 0; j < 10; ++j )
+      points.push_back( Point( i, j, i + 2 * j ) );
+  nb++;
+  if ( ! hull.compute( points.begin(), points.end() ) && ! hull.isInside( points[0] ) )
+    nbok++;   //coplanar points
+
+  //a thin tetrahedron with large coordinates
+  points.clear();
+  const Integer r = 1 << 18;
+  points.push_back( Point( -r, -r, -r ) );
+  points.push_back( Point( r, r, r - 1 ) );
+  points.push_back( Point( r, -r, r ) );
+  points.push_back( Point( -r, r, r ) );
+  points.push_back( Point( 0, 0, 0 ) );
+  points.push_back( Point( r - 1, r - 1, r - 2 ) );
+  nb++;
+  if ( hull.compute( points.begin(), points.end() ) && hull.isValid()
+       && hull.isInside( points[ 4 ] ) && hull.isInside( points[ 5 ] ) )
+    nbok++;
+  trace.info() << hull << endl;
+  trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class QuickHull3D" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testCube()
+    && testRandomPoints( 50, 10 )
+    && testRandomPoints( 5000, 20 )
+    && testDegenerateCases();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -30,10 +30,22 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
 #include <vector>
+#include <map>
+#include <cmath>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/geometry/volumes/estimation/VoronoiCovarianceMeasure.h"
 #include "DGtal/geometry/tools/SpatialCubicalSubdivision.h"
+#include "DGtal/math/MPolynomial.h"
+#include "DGtal/io/readers/MPolynomialReader.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/shapes/implicit/ImplicitPolynomial3Shape.h"
+#include "DGtal/topology/LightImplicitDigitalSurface.h"
+#include "DGtal/topology/DigitalSurface.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -106,6 +118,170 @@ bool testVoronoiCovarianceMeasure()
   return nbok == nb;
 }
 
+/**
+ * Compares the VCM with a brute-force computation over the whole
+ * domain, and the batch measure with the one-by-one measure.
+ */
+bool testVoronoiCovarianceMeasureArray()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  using namespace DGtal;
+  using namespace DGtal::Z3i; // gets Space, Point, Domain
+  trace.beginBlock ( "testVoronoiCovarianceMeasureArray" );
+  typedef ExactPredicateLpSeparableMetric<Space,2> Metric;
+  typedef VoronoiCovarianceMeasure<Space, Metric> VCM;
+  typedef VCM::MatrixNN Matrix;
+  typedef VCM::VectorN Vector;
+
+  // points of a digital sphere
+  std::vector<Point> pts;
+  Domain domain( Point::diagonal( -12 ), Point::diagonal( 12 ) );
+  for ( Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+    {
+      Point p = *it;
+      Integer n = p.dot( p );
+      if ( 81 <= n && n < 100 ) pts.push_back( p );
+    }
+  pts.push_back( pts.front() ); // duplicated point
+
+  Metric l2;
+  VCM vcm( 4.0, 3.0, l2, false );
+  vcm.init( pts.begin(), pts.end() );
+  nbok += ( vcm.sites().size() == pts.size() - 1 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << vcm.sites().size() << " sites" << std::endl;
+
+  // brute-force VCM
+  std::map<Point,Matrix> ref;
+  Domain d = vcm.domain();
+  for ( Domain::ConstIterator it = d.begin(), itE = d.end(); it != itE; ++it )
+    {
+      Point q = vcm.voronoiMap()( *it );
+      if ( q != *it && l2( q, *it ) <= vcm.R() )
+        {
+          Vector v = *it - q;
+          Matrix m;
+          for ( Dimension i = 0; i < 3; ++i )
+            for ( Dimension j = 0; j < 3; ++j )
+              m.setComponent( i, j, v[ i ] * v[ j ] );
+          ref[ q ] += m;
+        }
+    }
+  double error = 0.0;
+  for ( unsigned int k = 0; k < vcm.sites().size(); ++k )
+    {
+      Matrix diff = ref[ vcm.sites()[ k ] ] - vcm.vcmArray()[ k ];
+      for ( Dimension i = 0; i < 3; ++i )
+        for ( Dimension j = 0; j < 3; ++j )
+          error = std::max( error, std::abs( diff( i, j ) ) );
+    }
+  nbok += ( error < 1e-8 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "max error with brute force = " << error << std::endl;
+  nbok += ( vcm.vcmMap().size() == vcm.sites().size()
+            && vcm.vcmMap().begin()->second == vcm.vcmArray()[ 0 ] ) ? 1 : 0;
+  nb++;
+  nbok += ( vcm.siteIndex( vcm.sites()[ 10 ] ) == 10
+            && vcm.siteIndex( Point::diagonal( 0 ) ) == vcm.sites().size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") vcmMap, siteIndex" << std::endl;
+
+  // batch measure
+  functors::HatPointFunction< Point, double > chi_r( 1.0, 3.0 );
+  std::vector<Matrix> measures;
+  vcm.measure( chi_r, vcm.sites(), measures );
+  bool same = measures.size() == vcm.sites().size();
+  for ( unsigned int k = 0; same && k < measures.size(); ++k )
+    same = measures[ k ] == vcm.measure( chi_r, vcm.sites()[ k ] );
+  nbok += same ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") batch measure" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Compares the VCM of the points of the digital surface of
+ * testVoronoiCovarianceMeasureOnSurface computed with one thread and
+ * with several threads, and calls vcmMap concurrently.
+ */
+bool testVoronoiCovarianceMeasureOnSurfacePoints()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  using namespace DGtal;
+  using namespace DGtal::Z3i; // gets Space, Point, Domain, KSpace
+  trace.beginBlock ( "testVoronoiCovarianceMeasureOnSurfacePoints" );
+  typedef MPolynomial< 3, double > Polynomial3;
+  typedef MPolynomialReader<3, double> Polynomial3Reader;
+  typedef ImplicitPolynomial3Shape<Space> ImplicitShape;
+  typedef GaussDigitizer< Space, ImplicitShape > ImplicitDigitalShape;
+  typedef LightImplicitDigitalSurface<KSpace,ImplicitDigitalShape> SurfaceContainer;
+  typedef DigitalSurface< SurfaceContainer > Surface;
+  typedef Surface::ConstIterator ConstIterator;
+  typedef SurfaceContainer::Surfel Surfel;
+  typedef ExactPredicateLpSeparableMetric<Space,2> Metric;
+  typedef VoronoiCovarianceMeasure<Space, Metric> VCM;
+
+  std::string poly_str = "-81.0+x^2+y^2+z^2";
+  Polynomial3 poly;
+  Polynomial3Reader reader;
+  reader.read( poly, poly_str.begin(), poly_str.end() );
+  ImplicitShape shape( poly );
+  Point p1( -10, -10, -10 );
+  Point p2( 10, 10, 10 );
+  KSpace K;
+  K.init( p1, p2, true );
+  ImplicitDigitalShape dshape;
+  dshape.attach( shape );
+  dshape.init( p1, p2, 1.0 );
+  Surfel bel = Surfaces<KSpace>::findABel( K, dshape, 10000 );
+  Surface surface( new SurfaceContainer( K, dshape, SurfelAdjacency<KSpace::dimension>( true ), bel ) );
+  std::vector<Point> pts;
+  for ( ConstIterator it = surface.begin(), itE = surface.end(); it != itE; ++it )
+    {
+      const Dimension k = K.sOrthDir( *it );
+      pts.push_back( K.sCoords( K.sDirectIncident( *it, k ) ) );
+      pts.push_back( K.sCoords( K.sIndirectIncident( *it, k ) ) );
+    }
+
+  Metric l2;
+#ifdef WITH_OPENMP
+  const int nbThreads = omp_get_max_threads();
+  omp_set_num_threads( 1 );
+#endif
+  VCM sequential( 5.0, 7.0, l2, false );
+  sequential.init( pts.begin(), pts.end() );
+#ifdef WITH_OPENMP
+  omp_set_num_threads( std::max( nbThreads, 4 ) );
+#endif
+  VCM parallel( 5.0, 7.0, l2, false );
+  parallel.init( pts.begin(), pts.end() );
+  long nbErrors = 0;
+#ifdef WITH_OPENMP
+#pragma omp parallel for reduction(+:nbErrors)
+#endif
+  for ( long i = 0; i < 8; ++i )
+    if ( parallel.vcmMap() != sequential.vcmMap() ) ++nbErrors;
+#ifdef WITH_OPENMP
+  omp_set_num_threads( nbThreads );
+#endif
+  nbok += ( nbErrors == 0 && sequential.vcmMap().size() == sequential.sites().size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << sequential.sites().size() << " sites, "
+               << nbErrors << " maps differing from the sequential one" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -114,7 +290,9 @@ int main( int /* argc */, char** /* argv */ )
   using namespace std;
   using namespace DGtal;
   trace.beginBlock ( "Testing VoronoiCovarianceMeasure ..." );
-  bool res = testVoronoiCovarianceMeasure();
+  bool res = testVoronoiCovarianceMeasure()
+    && testVoronoiCovarianceMeasureArray()
+    && testVoronoiCovarianceMeasureOnSurfacePoints();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
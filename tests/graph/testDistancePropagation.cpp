@@ -30,6 +30,8 @@
  ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
 #include <set>
+#include <vector>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/CanonicEmbedder.h"
 #include "DGtal/helpers/StdDefs.h"
@@ -37,6 +39,9 @@
 #include "DGtal/graph/CGraphVisitor.h"
 #include "DGtal/graph/GraphVisitorRange.h"
 #include "DGtal/graph/DistanceBreadthFirstVisitor.h"
+#include "DGtal/graph/BucketQueue.h"
+#include "DGtal/graph/IndexedVertexSet.h"
+#include "DGtal/kernel/domains/Linearizer.h"
 #include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
 #include "DGtal/io/boards/Board2D.h"
 #include "DGtal/io/Color.h"
@@ -169,9 +174,188 @@ bool testDistancePropagation()
   return nb == nbok;
 }
 
+/// Squared Euclidean distance to a fixed point, an integer metric.
+struct SquaredDistanceToPoint
+{
+  typedef Z2i::Integer Value;
+  SquaredDistanceToPoint( const Z2i::Point & c ) : myCenter( c ) {}
+  Value operator()( const Z2i::Point & p ) const
+  {
+    Z2i::Vector v = p - myCenter;
+    return v.dot( v );
+  }
+  Z2i::Point myCenter;
+};
+
+/// Index of the points of a domain, for IndexedVertexSet.
+struct PointIndex
+{
+  PointIndex( const Z2i::Domain & domain ) : myDomain( domain ) {}
+  std::size_t operator()( const Z2i::Point & p ) const
+  { return Linearizer<Z2i::Domain>::getIndex( p, myDomain ); }
+  Z2i::Domain myDomain;
+};
+
+bool testBucketQueue()
+{
+  unsigned int nb = 0;
+  unsigned int nbok = 0;
+  typedef std::pair<int,int> Node;
+  trace.beginBlock( "BucketQueue" );
+  BucketQueue<Node> q;
+  std::vector<int> keys;
+  int values[] = { 12, 7, 30, 7, 3, 18, 0, 25, 12 };
+  for ( unsigned int i = 0; i < 9; ++i )
+    {
+      q.push( Node( (int) i, values[ i ] ) );
+      keys.push_back( values[ i ] );
+    }
+  std::sort( keys.begin(), keys.end() );
+  std::vector<int> popped;
+  while ( ! q.empty() )
+    {
+      popped.push_back( q.top().second );
+      q.pop();
+      if ( popped.size() == 3 ) // smaller than the popped keys.
+        {
+          q.push( Node( 9, -4 ) );
+          keys.insert( keys.begin() + 3, -4 );
+        }
+    }
+  ++nb, nbok += ( popped == keys ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb 
+               << ") keys are popped in increasing order."<< std::endl;
+  trace.endBlock();
+  return nb == nbok;
+}
+
+bool testBucketDistancePropagation()
+{
+  typedef Z2i::Point Point;
+  typedef Z2i::Domain Domain;
+  typedef Z2i::DigitalSet DigitalSet;
+  typedef Z2i::Object4_8 Object;
+  typedef SquaredDistanceToPoint::Value Value;
+  typedef std::pair<Point, Value> VisitedNode;
+
+  unsigned int nb = 0;
+  unsigned int nbok = 0;
+  trace.beginBlock( "Distance propagation with a bucket queue" );
+  Point p1( -41, -36 );
+  Point p2( 18, 18 );
+  Domain domain( p1, p2 );
+  Point c1( -2, -1 );
+  DigitalSet shape_set( domain );
+  Shapes<Domain>::addNorm2Ball( shape_set, c1, 9 );
+  Shapes<Domain>::addNorm1Ball( shape_set, Point( -14, 5 ), 9 );
+  Shapes<Domain>::addNorm2Ball( shape_set, Point( -10, -20 ), 12 );
+  Object obj( Z2i::dt4_8, shape_set );
+
+  typedef DistanceBreadthFirstVisitor< Object, SquaredDistanceToPoint,
+                                       std::set<Point> > HeapVisitor;
+  typedef IndexedVertexSet< Point, PointIndex > MarkSet;
+  typedef DistanceBreadthFirstVisitor< Object, SquaredDistanceToPoint,
+                                       MarkSet, BucketNodeQueue > BucketVisitor;
+  BOOST_CONCEPT_ASSERT(( CGraphVisitor< DistanceBreadthFirstVisitor
+                         < Object, SquaredDistanceToPoint,
+                         std::set<Point>, BucketNodeQueue > > ));
+
+  std::vector<VisitedNode> heapNodes;
+  HeapVisitor hvisitor( obj, SquaredDistanceToPoint( c1 ), c1 );
+  while ( ! hvisitor.finished() )
+    {
+      heapNodes.push_back( hvisitor.current() );
+      hvisitor.expand();
+    }
+  std::vector<VisitedNode> bucketNodes;
+  unsigned int nbdecreasing = 0;
+  MarkSet marks( PointIndex( domain ), domain.size() );
+  BucketVisitor bvisitor( obj, SquaredDistanceToPoint( c1 ), c1, marks );
+  while ( ! bvisitor.finished() )
+    {
+      if ( ! bucketNodes.empty() 
+           && bvisitor.current().second < bucketNodes.back().second )
+        ++nbdecreasing;
+      bucketNodes.push_back( bvisitor.current() );
+      bvisitor.expand();
+    }
+  trace.info() << "#visited=" << bucketNodes.size()
+               << " #decreasing=" << nbdecreasing << std::endl;
+  ++nb, nbok += ( bucketNodes.size() == shape_set.size() ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb 
+               << ") all vertices are visited."<< std::endl;
+  ++nb, nbok += ( bvisitor.markedVertices().size() == shape_set.size() ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb 
+               << ") all vertices are marked."<< std::endl;
+  std::sort( heapNodes.begin(), heapNodes.end() );
+  std::sort( bucketNodes.begin(), bucketNodes.end() );
+  ++nb, nbok += ( heapNodes == bucketNodes ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb 
+               << ") same vertices and distances as with a heap."<< std::endl;
+
+  ++nb, nbok += ( marks.size() == shape_set.size() ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb 
+               << ") the given mark set is the one of the visitor."<< std::endl;
+
+  // Ball of squared radius 40, layer by layer, then terminate.
+  marks.clear();
+  BucketVisitor lvisitor( obj, SquaredDistanceToPoint( c1 ), c1, marks );
+  std::vector<BucketVisitor::Node> layer;
+  unsigned int nbball = 0;
+  bool layerOk = true;
+  while ( ! lvisitor.finished() && lvisitor.current().second <= 40 )
+    {
+      lvisitor.getCurrentLayer( layer );
+      for ( unsigned int i = 0; i < layer.size(); ++i )
+        layerOk = layerOk && ( layer[ i ].second == layer[ 0 ].second );
+      nbball += layer.size();
+      lvisitor.expandLayer();
+    }
+  lvisitor.terminate();
+  unsigned int nbexpected = 0;
+  for ( DigitalSet::ConstIterator it = shape_set.begin(), itE = shape_set.end();
+        it != itE; ++it )
+    if ( SquaredDistanceToPoint( c1 )( *it ) <= 40 ) ++nbexpected;
+  ++nb, nbok += ( layerOk && nbball == nbexpected 
+                  && lvisitor.markedVertices().size() == nbexpected ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb 
+               << ") layers of the ball, #ball=" << nbball
+               << " #expected=" << nbexpected << std::endl;
+
+  // Many balls of squared radius 20, sharing the same mark set.
+  bool ballsOk = true;
+  unsigned int nbballs = 0;
+  for ( DigitalSet::ConstIterator it = shape_set.begin(), itE = shape_set.end();
+        it != itE; ++it, ++nbballs )
+    {
+      if ( nbballs % 50 != 0 ) continue;
+      marks.clear();
+      BucketVisitor visitor( obj, SquaredDistanceToPoint( *it ), *it, marks );
+      unsigned int nbvisited = 0;
+      while ( ! visitor.finished() && visitor.current().second <= 20 )
+        {
+          ++nbvisited;
+          visitor.expand();
+        }
+      visitor.terminate();
+      unsigned int nbin = 0;
+      for ( DigitalSet::ConstIterator it2 = shape_set.begin(); it2 != itE; ++it2 )
+        if ( SquaredDistanceToPoint( *it )( *it2 ) <= 20 ) ++nbin;
+      // The ball may be cut by the border of the shape.
+      ballsOk = ballsOk && nbvisited <= nbin && marks.size() == nbvisited;
+    }
+  ++nb, nbok += ballsOk ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb 
+               << ") balls with a reused mark set."<< std::endl;
+  trace.endBlock();
+  return nb == nbok;
+}
+
 int main( int /*argc*/, char** /*argv*/ )
 {
-  bool res = testDistancePropagation();
+  bool res = testDistancePropagation()
+    && testBucketQueue()
+    && testBucketDistancePropagation();
   return res ? 0 : 1;
 }
 
@@ -0,0 +1,247 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testParallelBreadthFirstVisitor.cpp
+ * @ingroup Tests
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class ParallelBreadthFirstVisitor.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <map>
+#include <set>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/topology/FrozenDigitalSurface.h"
+#include "DGtal/graph/BreadthFirstVisitor.h"
+#include "DGtal/graph/ParallelBreadthFirstVisitor.h"
+#include "DGtal/shapes/Shapes.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ParallelBreadthFirstVisitor.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Index of the points of a domain, for IndexedVertexMarker.
+struct PointIndex
+{
+  PointIndex( const Domain & domain ) : myDomain( domain ) {}
+  std::size_t operator()( const Point & p ) const
+  { return Linearizer<Domain>::getIndex( p, myDomain ); }
+  Domain myDomain;
+};
+
+/**
+ * Computes the distances of all the vertices reachable from the
+ * given seed with a BreadthFirstVisitor.
+ */
+template <typename Graph>
+std::map<typename Graph::Vertex, std::size_t>
+referenceDistances( const Graph & graph, const typename Graph::Vertex & seed )
+{
+  std::map<typename Graph::Vertex, std::size_t> distances;
+  BreadthFirstVisitor<Graph, std::set<typename Graph::Vertex> > visitor( graph, seed );
+  while ( ! visitor.finished() )
+    {
+      distances[ visitor.current().first ] = visitor.current().second;
+      visitor.expand();
+    }
+  return distances;
+}
+
+/**
+ * Checks that the layers of the visitor are exactly the vertices at
+ * the given distances.
+ */
+template <typename Visitor, typename Vertex>
+bool checkLayers( Visitor & visitor,
+                  const std::map<Vertex, std::size_t> & distances )
+{
+  std::size_t nbVisited = 0;
+  bool ok = true;
+  do
+    {
+      for ( typename Visitor::ConstIterator it = visitor.begin(),
+              itE = visitor.end(); it != itE; ++it )
+        {
+          typename std::map<Vertex, std::size_t>::const_iterator
+            itD = distances.find( *it );
+          ok = ok && ( itD != distances.end() )
+            && ( itD->second == visitor.distance() );
+        }
+      ok = ok && std::adjacent_find( visitor.begin(), visitor.end() )
+        == visitor.end();
+      nbVisited += visitor.layer().size();
+    }
+  while ( visitor.nextLayer() );
+  return ok && visitor.finished()
+    && ( nbVisited == distances.size() )
+    && ( visitor.nbMarked() == distances.size() );
+}
+
+/**
+ * Compares the layers of ParallelBreadthFirstVisitor with the
+ * distances given by BreadthFirstVisitor on an object, with both
+ * kinds of markers.
+ */
+bool testParallelBreadthFirstVisitorObject()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing ParallelBreadthFirstVisitor on an object..." );
+  Point p1( -12, -12, -12 );
+  Point p2( 12, 12, 12 );
+  Domain domain( p1, p2 );
+  DigitalSet set( domain );
+  Shapes<Domain>::addNorm2Ball( set, Point( 0, 0, 0 ), 11 );
+  Shapes<Domain>::removeNorm2Ball( set, Point( 3, 0, 0 ), 5 );
+  Shapes<Domain>::removeNorm1Ball( set, Point( -5, 4, 2 ), 3 );
+  Object6_18 object( dt6_18, set );
+  Point seed( -10, 0, 0 );
+  std::map<Point, std::size_t> distances = referenceDistances( object, seed );
+  trace.info() << "#reachable=" << distances.size() << std::endl;
+
+  typedef ParallelBreadthFirstVisitor<Object6_18> SetVisitor;
+  SetVisitor setVisitor( object, seed,
+                         VertexSetMarker<Point,DigitalSet>( DigitalSet( domain ) ) );
+  trace.info() << setVisitor << std::endl;
+  nbok += checkLayers( setVisitor, distances ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "layers with VertexSetMarker == BreadthFirstVisitor" << std::endl;
+
+  typedef IndexedVertexMarker<Point,PointIndex> Marker;
+  typedef ParallelBreadthFirstVisitor<Object6_18, Marker> IndexedVisitor;
+  IndexedVisitor indexedVisitor( object, seed,
+                                 Marker( PointIndex( domain ), domain.size() ) );
+  nbok += checkLayers( indexedVisitor, distances ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "layers with IndexedVertexMarker == BreadthFirstVisitor" << std::endl;
+
+  // Predicate: only the half-space x <= 0, from several seeds.
+  std::vector<Point> seeds;
+  seeds.push_back( Point( -10, 0, 0 ) );
+  seeds.push_back( Point( 0, 10, 0 ) );
+  seeds.push_back( Point( -10, 0, 0 ) );
+  IndexedVisitor halfVisitor( object, seeds.begin(), seeds.end(),
+                              Marker( PointIndex( domain ), domain.size() ) );
+  nbok += ( halfVisitor.layer().size() == 2 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "duplicated seeds are visited once" << std::endl;
+  bool ok = true;
+  std::size_t nbVisited = 2;
+  while ( halfVisitor.nextLayer( [] ( const Point & p ) { return p[ 0 ] <= 0; } ) )
+    {
+      for ( IndexedVisitor::ConstIterator it = halfVisitor.begin(),
+              itE = halfVisitor.end(); it != itE; ++it )
+        ok = ok && ( (*it)[ 0 ] <= 0 );
+      nbVisited += halfVisitor.layer().size();
+    }
+  nbok += ( ok && nbVisited == halfVisitor.nbMarked() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "visited vertices satisfy the predicate, #visited="
+               << nbVisited << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Compares the layers of ParallelBreadthFirstVisitor with the
+ * distances given by BreadthFirstVisitor on a frozen digital surface.
+ */
+bool testParallelBreadthFirstVisitorSurface()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef DigitalSetBoundary<KSpace,DigitalSet> Container;
+  typedef DigitalSurface<Container> Surface;
+  typedef FrozenDigitalSurface<Container> Frozen;
+
+  trace.beginBlock ( "Testing ParallelBreadthFirstVisitor on a surface..." );
+  Point p1( -10, -10, -10 );
+  Point p2( 10, 10, 10 );
+  Domain domain( p1, p2 );
+  DigitalSet set( domain );
+  Shapes<Domain>::addNorm2Ball( set, Point( -2, 0, 0 ), 6 );
+  Shapes<Domain>::removeNorm2Ball( set, Point( -2, 0, 0 ), 2 );
+  Shapes<Domain>::addNorm1Ball( set, Point( 7, 5, 5 ), 2 );
+  KSpace K;
+  K.init( p1, p2, true );
+  Surface surface( new Container( K, set ) );
+  Frozen frozen( surface );
+  std::map<Frozen::Vertex, std::size_t> distances
+    = referenceDistances( frozen, 0 );
+  trace.info() << "#reachable=" << distances.size()
+               << " #vertices=" << frozen.size() << std::endl;
+
+  ParallelBreadthFirstVisitor<Frozen> setVisitor( frozen, 0 );
+  nbok += checkLayers( setVisitor, distances ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "layers with VertexSetMarker == BreadthFirstVisitor" << std::endl;
+
+  typedef IndexedVertexMarker<Frozen::Vertex,functors::Identity> Marker;
+  ParallelBreadthFirstVisitor<Frozen,Marker>
+    indexedVisitor( frozen, 0, Marker( functors::Identity(), frozen.size() ) );
+  nbok += checkLayers( indexedVisitor, distances ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "layers with IndexedVertexMarker == BreadthFirstVisitor" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ParallelBreadthFirstVisitor" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testParallelBreadthFirstVisitorObject()
+    && testParallelBreadthFirstVisitorSurface();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
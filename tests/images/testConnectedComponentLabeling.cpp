@@ -0,0 +1,191 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testConnectedComponentLabeling.cpp
+ * @ingroup Tests
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class ConnectedComponentLabeling.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <set>
+#include <cstdlib>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/Object.h"
+#include "DGtal/images/ConnectedComponentLabeling.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ConnectedComponentLabeling.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Predicate telling if a point belongs to a digital set.
+template <typename DigitalSet>
+struct InSet
+{
+  typedef typename DigitalSet::Point Point;
+  InSet( const DigitalSet & set ) : mySet( set ) {}
+  bool operator()( const Point & p ) const
+  { return mySet.find( p ) != mySet.end(); }
+  const DigitalSet & mySet;
+};
+
+/**
+ * Labels the components of a random set and compares them with the
+ * components of the object given by writeComponents.
+ */
+template <typename Object>
+bool testLabeling( const typename Object::DigitalTopology & topology,
+                   const typename Object::Domain & domain, int density,
+                   const std::string & name )
+{
+  typedef typename Object::DigitalTopology::ForegroundAdjacency Adjacency;
+  typedef typename Object::DigitalSet DigitalSet;
+  typedef typename Object::Point Point;
+  typedef ConnectedComponentLabeling<Adjacency> Labeling;
+  typedef typename Labeling::Label Label;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing labeling with " + name );
+  srand( 0 );
+  DigitalSet set( domain );
+  for ( typename Object::Domain::ConstIterator it = domain.begin(),
+          itE = domain.end(); it != itE; ++it )
+    if ( rand() % 100 < density ) set.insertNew( *it );
+  Object object( topology, set );
+  std::vector<Object> components;
+  std::back_insert_iterator< std::vector<Object> > itC( components );
+  object.writeComponents( itC );
+
+  typename Labeling::LabelImage labels( domain );
+  Labeling labeling;
+  Label nbLabels = labeling.compute( InSet<DigitalSet>( set ), labels );
+  trace.info() << labeling << " #points=" << set.size() << std::endl;
+  nbok += ( nbLabels == components.size()
+            && labeling.nbComponents() == nbLabels ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "#labels=" << nbLabels << " == #components="
+               << components.size() << std::endl;
+
+  // Each component has one label, which is not the one of another
+  // component, and its statistics.
+  bool ok = true;
+  std::set<Label> used;
+  for ( unsigned int c = 0; c < components.size(); ++c )
+    {
+      const DigitalSet & cset = components[ c ].pointSet();
+      Label l = labels( *cset.begin() );
+      ok = ok && l != 0 && used.insert( l ).second;
+      if ( ! ok ) break;
+      Point lower = *cset.begin();
+      Point upper = *cset.begin();
+      for ( typename DigitalSet::ConstIterator it = cset.begin(),
+              itE = cset.end(); it != itE; ++it )
+        {
+          ok = ok && labels( *it ) == l;
+          lower = lower.inf( *it );
+          upper = upper.sup( *it );
+        }
+      ok = ok && labeling.statistics( l ).size == cset.size()
+        && labeling.statistics( l ).lowerBound == lower
+        && labeling.statistics( l ).upperBound == upper;
+    }
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same components and statistics" << std::endl;
+
+  // Labels appear in increasing order in the raster scan, background is 0.
+  Label maxLabel = 0;
+  ok = true;
+  for ( typename Object::Domain::ConstIterator it = domain.begin(),
+          itE = domain.end(); it != itE; ++it )
+    {
+      Label l = labels( *it );
+      ok = ok && ( ( l == 0 ) == ( set.find( *it ) == set.end() ) )
+        && l <= maxLabel + 1;
+      maxLabel = std::max( maxLabel, l );
+    }
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "labels are ordered by raster scan" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Labeling of an empty domain.
+ */
+bool testEmptyDomain()
+{
+  typedef ConnectedComponentLabeling<Z3i::Adj6> Labeling;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing labeling of an empty domain" );
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( -1, -1, -1 ) );
+  Z3i::DigitalSet set( Z3i::Domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 3, 3, 3 ) ) );
+  Labeling::LabelImage labels( domain );
+  Labeling labeling;
+  Labeling::Label nbLabels = labeling.compute( InSet<Z3i::DigitalSet>( set ), labels );
+  nbok += ( nbLabels == 0 && labeling.nbComponents() == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "#labels=" << nbLabels << " == 0" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ConnectedComponentLabeling" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  Z2i::Domain domain2( Z2i::Point( -20, -10 ), Z2i::Point( 29, 49 ) );
+  Z3i::Domain domain3( Z3i::Point( 0, 0, 0 ), Z3i::Point( 15, 12, 20 ) );
+  bool res = testLabeling<Z2i::Object4_8>( Z2i::dt4_8, domain2, 55, "4-adjacency" )
+    && testLabeling<Z2i::Object8_4>( Z2i::dt8_4, domain2, 40, "8-adjacency" )
+    && testLabeling<Z3i::Object6_18>( Z3i::dt6_18, domain3, 30, "6-adjacency" )
+    && testLabeling<Z3i::Object18_6>( Z3i::dt18_6, domain3, 20, "18-adjacency" )
+    && testLabeling<Z3i::Object26_6>( Z3i::dt26_6, domain3, 12, "26-adjacency" )
+    && testEmptyDomain();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
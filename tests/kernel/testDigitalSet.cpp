@@ -51,6 +51,7 @@
 #include "DGtal/kernel/domains/CDomainArchetype.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/kernel/sets/DigitalSetByBitVector.h"
 #include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
 #include "DGtal/kernel/sets/DigitalSetFromMap.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
@@ -376,6 +377,36 @@ bool testDigitalSetConcept()
   return true;
 }
 
+bool testDigitalSetByBitVectorRuns()
+{
+  typedef SpaceND<2> Space2Type;
+  typedef HyperRectDomain<Space2Type> Domain2;
+  typedef Space2Type::Point Point2;
+
+  trace.beginBlock( "DigitalSetByBitVector runs" );
+  const Domain2 domain( Point2( -10, 0 ), Point2( 139, 3 ) );
+  DigitalSetByBitVector<Domain2> set( domain );
+  DigitalSetBySTLSet<Domain2> ref( domain );
+  set.insert( Point2( 70, 1 ) );
+  ref.insert( Point2( 70, 1 ) );
+  // runs across word boundaries, overlapping a point of the set
+  const Point2 starts[] = { Point2( -10, 0 ), Point2( 50, 1 ), Point2( 130, 2 ), Point2( -10, 3 ) };
+  const Domain2::Size lengths[] = { 150, 70, 10, 1 };
+  for ( unsigned int i = 0; i < 4; ++i )
+    {
+      set.insertRun( starts[ i ], lengths[ i ] );
+      Point2 p = starts[ i ];
+      for ( Domain2::Size k = 0; k < lengths[ i ]; ++k, ++p[0] )
+        ref.insert( p );
+    }
+  bool ok = set.size() == ref.size();
+  for ( Domain2::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    ok = ok && ( set( *it ) == ( ref.find( *it ) != ref.end() ) );
+  trace.info() << set << " " << ref << std::endl;
+  trace.endBlock();
+  return ok;
+}
+
 int main()
 {
   typedef SpaceND<4> Space4Type;
@@ -404,6 +435,11 @@ int main()
     ( DigitalSetBySTLSet<Domain>(domain), DigitalSetBySTLSet<Domain>(domain) );
   trace.endBlock();
 
+  trace.beginBlock( "DigitalSetByBitVector" );
+  bool okBitVector = testDigitalSet< DigitalSetByBitVector<Domain> >
+    ( DigitalSetByBitVector<Domain>(domain), DigitalSetByBitVector<Domain>(domain) );
+  trace.endBlock();
+
   trace.beginBlock( "DigitalSetFromMap" );
   typedef ImageContainerBySTLMap<Domain,short int> Map;
   Map map(domain); Map map2(domain);        //maps
@@ -442,7 +478,9 @@ int main()
 
   bool okDigitalSetDrawSnippet = testDigitalSetBoardSnippet();
 
-  bool res = okVector && okSet && okMap
+  bool okBitVectorRuns = testDigitalSetByBitVectorRuns();
+
+  bool res = okVector && okSet && okBitVector && okBitVectorRuns && okMap
       && okSelectorSmall && okSelectorBig && okSelectorMediumHBel
       && okDigitalSetDomain && okDigitalSetDraw && okDigitalSetDrawSnippet
      && okUnorderedSet && okAssoctestSet;
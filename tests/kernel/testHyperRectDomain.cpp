@@ -285,6 +285,42 @@ bool testSTLCompat()
   return myHyperRectDomain4D.isValid();
 }
 
+bool testScanlines()
+{
+  typedef SpaceND<3> TSpace3D;
+  typedef TSpace3D::Point Point3D;
+  typedef HyperRectDomain<TSpace3D> Domain;
+
+  trace.beginBlock ( "Test scanlines" );
+
+  const Domain domain ( Point3D( -2, 1, 3 ), Point3D( 4, 3, 7 ) );
+  trace.info() << domain << " nbScanlines=" << domain.nbScanlines() << std::endl;
+
+  bool res = domain.nbScanlines() == 3 * 5;
+  Domain::ConstIterator itPoint = domain.begin();
+  Domain::Size offset = 0;
+  Domain::Size index = 0;
+  for ( Domain::ConstScanlineIterator it = domain.scanlines().begin(), itEnd = domain.scanlines().end();
+        it != itEnd; ++it, ++index )
+    {
+      const Domain::Scanline aScanline = domain.scanline( index );
+      res = res && it->length == 7 && it->offset == offset
+        && aScanline.start == it->start && aScanline.offset == it->offset;
+      Point3D p = it->start;
+      for ( Domain::Size k = 0; k < it->length; ++k, ++p[0], ++itPoint, ++offset )
+        res = res && p == *itPoint;
+    }
+  res = res && index == domain.nbScanlines() && itPoint == domain.end();
+
+  const Domain emptyDomain ( Point3D( 1, 1, 1 ), Point3D( 0, 0, 0 ) );
+  res = res && emptyDomain.nbScanlines() == 0
+    && emptyDomain.scanlines().begin() == emptyDomain.scanlines().end();
+
+  trace.endBlock();
+
+  return res;
+}
+
 bool testEmptyDomain()
 {
   typedef SpaceND<3> TSpace;
@@ -359,7 +395,7 @@ bool testEmptyDomain()
 
 int main()
 {
-  if ( testSimpleHyperRectDomain() && testIterator() && testReverseIterator() && testSTLCompat() && testEmptyDomain() )
+  if ( testSimpleHyperRectDomain() && testIterator() && testReverseIterator() && testSTLCompat() && testScanlines() && testEmptyDomain() )
     return 0;
   else
     return 1;
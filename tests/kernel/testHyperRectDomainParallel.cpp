@@ -0,0 +1,162 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testHyperRectDomainParallel.cpp
+ * @ingroup Tests
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * This file is part of the DGtal library
+ */
+
+/**
+ * Description of testHyperRectDomainParallel.cpp <p>
+ * Aim: Tests of parallel loops over slabs of HyperRectDomain.
+ */
+
+#include <cstddef>
+#include <vector>
+#include <functional>
+
+#include "DGtalCatch.h"
+
+#include <DGtal/kernel/SpaceND.h>
+#include <DGtal/kernel/domains/HyperRectDomain.h>
+#include <DGtal/kernel/domains/HyperRectDomainParallel.h>
+#include <DGtal/kernel/domains/Linearizer.h>
+
+using namespace DGtal;
+
+namespace
+{
+  typedef SpaceND<3> Space;
+  typedef HyperRectDomain<Space> Domain;
+  typedef Domain::Point Point;
+  typedef Domain::Size Size;
+  typedef Linearizer<Domain> DomainLinearizer;
+
+  /// Checks that slabs have the lexicographic offset of their lower bound.
+  struct CheckOffset
+  {
+    CheckOffset( const Domain & aDomain, std::vector<int> & someErrors )
+      : myDomain( &aDomain ), myErrors( &someErrors ) {}
+
+    void operator()( std::size_t anIndex, const Domain & aSlab, Size anOffset ) const
+    {
+      ( *myErrors )[ anIndex ] = DomainLinearizer::getIndex( aSlab.lowerBound(), *myDomain ) == anOffset ? 0 : 1;
+    }
+
+    const Domain * myDomain;
+    std::vector<int> * myErrors;
+  };
+
+  /// Counts the visits of each point.
+  struct CountVisits
+  {
+    CountVisits( const Domain & aDomain, std::vector<int> & someVisits )
+      : myDomain( &aDomain ), myVisits( &someVisits ) {}
+
+    void operator()( const Point & aPoint ) const
+    {
+      ++( *myVisits )[ DomainLinearizer::getIndex( aPoint, *myDomain ) ];
+    }
+
+    const Domain * myDomain;
+    std::vector<int> * myVisits;
+  };
+
+  /// Maps a point to the sum of its coordinates.
+  struct SumOfCoordinates
+  {
+    long operator()( const Point & aPoint ) const
+    {
+      return static_cast<long>( aPoint[ 0 ] + aPoint[ 1 ] + aPoint[ 2 ] );
+    }
+  };
+}
+
+TEST_CASE( "Testing splitDomainIntoSlabs", "[test][parallel]" )
+{
+  SECTION( "Slabs across the last dimension" )
+    {
+      const Domain domain( Point( -3, 0, 2 ), Point( 4, 5, 12 ) );
+      const std::vector<Domain> slabs = splitDomainIntoSlabs( domain, 4 );
+      REQUIRE( slabs.size() == 4 );
+
+      Size size = 0;
+      Point::Coordinate next = domain.lowerBound()[ 2 ];
+      for ( std::size_t i = 0; i < slabs.size(); ++i )
+        {
+          REQUIRE( slabs[ i ].lowerBound()[ 2 ] == next );
+          REQUIRE( slabs[ i ].upperBound()[ 0 ] == domain.upperBound()[ 0 ] );
+          REQUIRE( slabs[ i ].upperBound()[ 1 ] == domain.upperBound()[ 1 ] );
+          next = slabs[ i ].upperBound()[ 2 ] + 1;
+          size += slabs[ i ].size();
+        }
+      REQUIRE( next == domain.upperBound()[ 2 ] + 1 );
+      REQUIRE( size == domain.size() );
+    }
+
+  SECTION( "Slabs across the last non-degenerated dimension" )
+    {
+      const Domain domain( Point( 0, 0, 7 ), Point( 9, 2, 7 ) );
+      const std::vector<Domain> slabs = splitDomainIntoSlabs( domain, 64 );
+      REQUIRE( slabs.size() == 3 );
+      for ( std::size_t i = 0; i < slabs.size(); ++i )
+        REQUIRE( slabs[ i ].lowerBound()[ 1 ] == slabs[ i ].upperBound()[ 1 ] );
+    }
+
+  SECTION( "Empty domain" )
+    {
+      const Domain domain( Point( 1, 1, 1 ), Point( 0, 0, 0 ) );
+      REQUIRE( splitDomainIntoSlabs( domain, 4 ).empty() );
+    }
+}
+
+TEST_CASE( "Testing parallel loops over HyperRectDomain", "[test][parallel]" )
+{
+  const Domain domain( Point( -3, 0, 2 ), Point( 14, 9, 40 ) );
+
+  SECTION( "Slab offsets" )
+    {
+      std::vector<int> errors( 64, 0 );
+      parallelForEachSubDomain( domain, CheckOffset( domain, errors ) );
+      for ( std::size_t i = 0; i < errors.size(); ++i )
+        REQUIRE( errors[ i ] == 0 );
+    }
+
+  SECTION( "Each point is visited once" )
+    {
+      std::vector<int> visits( domain.size(), 0 );
+      parallelForEach( domain, CountVisits( domain, visits ) );
+      for ( std::size_t i = 0; i < visits.size(); ++i )
+        REQUIRE( visits[ i ] == 1 );
+    }
+
+  SECTION( "Reduction" )
+    {
+      long sum = 3;
+      for ( Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+        sum += SumOfCoordinates()( *it );
+
+      REQUIRE( parallelReduce( domain, 3L, SumOfCoordinates(), std::plus<long>() ) == sum );
+      REQUIRE( parallelReduce( domain, 3L, SumOfCoordinates(), std::plus<long>(), 1 ) == sum );
+      REQUIRE( parallelReduce( Domain( Point( 1, 1, 1 ), Point( 0, 0, 0 ) ),
+                               3L, SumOfCoordinates(), std::plus<long>() ) == 3L );
+    }
+}
@@ -112,6 +112,16 @@ bool testImageFromSet()
   nb++;
   trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
 
+  //the scanline fill of image2 agrees with the generic one
+  ImageContainerBySTLMap<Domain,int> image2Map(d);
+  imageFromFunctor(image2Map, n);
+  bool flagScanlines = true;
+  for (Domain::ConstIterator it = d.begin(), itEnd = d.end(); it != itEnd; ++it)
+    flagScanlines = flagScanlines && (image2(*it) == image2Map(*it));
+  nbok += flagScanlines ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+
   Image image3 = image;
   //fill image3 from image2
   imageFromImage(image3, const_cast<Image const&>(image2));
@@ -127,6 +137,18 @@ bool testImageFromSet()
   nb++;
   trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
 
+  //the parallel fill and copy agree with the sequential ones
+  Image image4(d);
+  parallelImageFromFunctor(image4, n);
+  Image image5(d);
+  parallelImageFromImage(image5, const_cast<Image const&>(image4));
+  Image::ConstRange rimg4 = image4.constRange();
+  Image::ConstRange rimg5 = image5.constRange();
+  nbok += ( std::equal(rimg2.begin(), rimg2.end(), rimg4.begin())
+            && std::equal(rimg2.begin(), rimg2.end(), rimg5.begin()) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+
   trace.endBlock();
 
   return nbok == nb;
@@ -200,6 +222,22 @@ bool testSetFromImage()
   nb++;
   trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
 
+  //same sets, scanned in parallel
+  typedef ImageContainerBySTLVector<Domain,int> VectorImage;
+  VectorImage vectorImage(d);
+  imageFromImage(vectorImage, image);
+  DigitalSet aSet6(d);
+  DigitalSetInserter<DigitalSet> inserter6(aSet6);
+  parallelSetFromImage( vectorImage, inserter6, 126 );
+  DigitalSet aSet7(d);
+  DigitalSetInserter<DigitalSet> inserter7(aSet7);
+  parallelSetFromImage( vectorImage, inserter7, 2, 100 );
+  nbok += ( (aSet6.size()==aSet.size())
+            &&(aSet6.find(p) == aSet6.end())
+            &&(aSet7.find(r)!=aSet7.end())&&(aSet7.size()==1) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+
   DigitalSet aSet5(d);
   DigitalSetInserter<DigitalSet> inserter5(aSet5);
   //predicate construction
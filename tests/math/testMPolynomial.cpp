@@ -31,8 +31,11 @@
 #include <iostream>
 #include <iomanip>
 #include <sstream>
+#include <vector>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/MPolynomial.h"
+#include "DGtal/math/CompiledMPolynomial3.h"
 #include "DGtal/io/readers/MPolynomialReader.h"
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -189,6 +192,104 @@ bool testMPolynomial()
 }
 
 
+/**
+ * Compiled polynomials give the same values as mpolynomials, and
+ * their batch and row evaluators give the same values as the scalar
+ * one, up to rounding errors.
+ */
+bool testCompiledMPolynomial3( double step = 0.05 )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing block ... CompiledMPolynomial3" );
+  MPolynomial<3, double> P = durchblick<double>();
+  CompiledMPolynomial3<double> CP( P );
+  CompiledMPolynomial3<double> CPx( derivative<0>( P ) );
+  CompiledMPolynomial3<double> CPz( derivative<2>( P ) );
+  trace.info() << CP << " " << CPx << " " << CPz << std::endl;
+
+  std::vector<double> xs, ys, zs;
+  double error = 0.0;
+  for ( double x = -1.0; x < 1.0; x += step )
+    for ( double y = -1.0; y < 1.0; y += step )
+      for ( double z = -1.0; z < 1.0; z += step )
+        {
+          error = std::max( error, fabs( CP( x, y, z ) - durchblickC( x, y, z ) ) );
+          error = std::max( error, fabs( CPx( x, y, z ) - ( 3.0*x*x*y + z*z*z ) ) );
+          error = std::max( error, fabs( CPz( x, y, z )
+                                         - ( 3.0*x*z*z + y*y*y + 3.0*z*z + 5.0 ) ) );
+          xs.push_back( x );
+          ys.push_back( y );
+          zs.push_back( z );
+        }
+  trace.info() << "max error = " << error << std::endl;
+  nbok += error < 1e-12 ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "compiled values and derivatives" << std::endl;
+
+  std::vector<double> values( xs.size() );
+  CP.evaluate( &xs[ 0 ], &ys[ 0 ], &zs[ 0 ], &values[ 0 ], xs.size() );
+  // evaluation orders and FP contraction may change the last bits
+  bool same = true;
+  for ( std::size_t i = 0; i < xs.size(); ++i )
+    {
+      const double v = CP( xs[ i ], ys[ i ], zs[ i ] );
+      same = same && fabs( values[ i ] - v ) <= 1e-10 * std::max( 1.0, fabs( v ) );
+    }
+  nbok += same ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "batch evaluation" << std::endl;
+
+  std::vector<double> row( 101 ), rowValues( row.size() );
+  for ( std::size_t i = 0; i < row.size(); ++i )
+    row[ i ] = -1.0 + 0.02 * i;
+  CP.evaluateRow( &row[ 0 ], 0.3, -0.7, &rowValues[ 0 ], row.size() );
+  same = true;
+  for ( std::size_t i = 0; i < row.size(); ++i )
+    {
+      const double v = CP( row[ i ], 0.3, -0.7 );
+      same = same && fabs( rowValues[ i ] - v ) <= 1e-10 * std::max( 1.0, fabs( v ) );
+    }
+  nbok += same ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "row evaluation" << std::endl;
+
+  CompiledMPolynomial3<double> zero;
+  CompiledMPolynomial3<double> constant( MPolynomial<3, double>( 2.5 ) );
+  nbok += ( zero.degree() == -1 && zero( 1.0, 2.0, 3.0 ) == 0.0
+            && constant( 1.0, 2.0, 3.0 ) == 2.5 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "zero and constant polynomials" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Testing block ... Evaluation speed of compiled mpolynomials" );
+  double total = 0.0;
+  for ( double x = -1.0; x < 1.0; x += step )
+    for ( double y = -1.0; y < 1.0; y += step )
+      for ( double z = -1.0; z < 1.0; z += step )
+        total += CP( x, y, z );
+  trace.info() << "Total = " << total << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Testing block ... Evaluation speed of compiled mpolynomials (batch)" );
+  CP.evaluate( &xs[ 0 ], &ys[ 0 ], &zs[ 0 ], &values[ 0 ], xs.size() );
+  double total1 = 0.0;
+  for ( std::size_t i = 0; i < values.size(); ++i )
+    total1 += values[ i ];
+  trace.info() << "Total1 = " << total1 << std::endl;
+  trace.endBlock();
+  nbok += total1 == total ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "total1 == total" << std::endl;
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -197,7 +298,8 @@ int main( int /*argc*/, char** /*argv*/ )
   trace.beginBlock ( "Testing class MPolynomial" );
 
   bool res = testMPolynomial()
-    && testMPolynomialSpeed( 0.05 );
+    && testMPolynomialSpeed( 0.05 )
+    && testCompiledMPolynomial3( 0.05 );
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
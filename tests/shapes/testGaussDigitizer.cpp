@@ -37,6 +37,8 @@
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/shapes/parametric/Ellipse2D.h"
 #include "DGtal/shapes/parametric/Flower2D.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/kernel/sets/DigitalSetByBitVector.h"
 #include "DGtal/shapes/Shapes.h"
 #include "DGtal/topology/helpers/Surfaces.h"
 #include "DGtal/geometry/curves/GridCurve.h"
@@ -180,6 +182,80 @@ bool testGaussDigitizer()
   return nbok == nb;
 }
 
+/**
+ * Digitization by runs gives the same points as the point by point
+ * digitization, in 2D and 3D, and euclideanShaper fills
+ * DigitalSetByBitVector run by run.
+ */
+bool testDigitizeRuns()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing GaussDigitizer::digitizeRuns." );
+
+  typedef Flower2D< Z2i::Space > MyFlower;
+  MyFlower flower( 0.5, -2.3, 5.0, 0.7, 6, 0.3 );
+  GaussDigitizer<Z2i::Space,MyFlower> dig2;
+  dig2.attach( flower );
+  dig2.init( flower.getLowerBound(), flower.getUpperBound(), 0.1 );
+
+  typedef GaussDigitizer<Z2i::Space,MyFlower>::Run Run2;
+  std::vector<Run2> runs2;
+  dig2.digitizeRuns( std::back_inserter( runs2 ) );
+  Z2i::DigitalSet set2( dig2.getDomain() );
+  Z2i::Domain::Size previous = 0;
+  bool ordered = true;
+  for ( std::vector<Run2>::const_iterator it = runs2.begin(); it != runs2.end(); ++it )
+    {
+      ordered = ordered && it->length > 0 && it->offset >= previous;
+      previous = it->offset + it->length;
+      Z2i::Point p = it->start;
+      for ( Z2i::Domain::Size k = 0; k < it->length; ++k, ++p[0] )
+        set2.insertNew( p );
+    }
+  Z2i::DigitalSet ref2( dig2.getDomain() );
+  Shapes<Z2i::Domain>::digitalShaper( ref2, dig2 );
+  trace.info() << runs2.size() << " runs for " << ref2.size() << " points" << std::endl;
+  nbok += ( ordered && set2.size() == ref2.size()
+            && std::equal( ref2.begin(), ref2.end(), set2.begin() ) ) ? 1 : 0;
+  nb++;
+
+  std::vector<Run2> parallelRuns2;
+  dig2.parallelDigitizeRuns( std::back_inserter( parallelRuns2 ) );
+  bool same = parallelRuns2.size() == runs2.size();
+  for ( std::size_t i = 0; same && i < runs2.size(); ++i )
+    same = parallelRuns2[ i ].start == runs2[ i ].start
+      && parallelRuns2[ i ].offset == runs2[ i ].offset
+      && parallelRuns2[ i ].length == runs2[ i ].length;
+  nbok += same ? 1 : 0;
+  nb++;
+
+  typedef ImplicitBall< Z3i::Space > MyBall;
+  MyBall ball( Z3i::RealPoint( 0.3, -0.2, 0.1 ), 2.7 );
+  typedef DigitalSetByBitVector<Z3i::Domain> BitSet;
+  Z3i::Domain domain3( Z3i::Point::diagonal( -30 ), Z3i::Point::diagonal( 30 ) );
+  BitSet set3( domain3 );
+  Z3i::DigitalSet ref3( domain3 );
+  Shapes<Z3i::Domain>::euclideanShaper( set3, ball, 0.1 );
+  GaussDigitizer<Z3i::Space,MyBall> dig3;
+  dig3.attach( ball );
+  dig3.init( ball.getLowerBound(), ball.getUpperBound(), 0.1 );
+  Shapes<Z3i::Domain>::digitalShaper( ref3, dig3 );
+  trace.info() << set3 << " " << ref3 << std::endl;
+  bool included = true;
+  for ( Z3i::DigitalSet::ConstIterator it = ref3.begin(); it != ref3.end(); ++it )
+    included = included && set3( *it );
+  nbok += ( set3.size() == ref3.size() && included ) ? 1 : 0;
+  nb++;
+
+  trace.info() << "(" << nbok << "/" << nb << ") "
+         << "true == true" << std::endl;
+  trace.endBlock();
+  
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -191,7 +267,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testConcept() && testGaussDigitizer(); // && ... other tests
+  bool res = testConcept() && testGaussDigitizer() && testDigitizeRuns(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,200 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImplicitPolynomial3OctreeDigitizer.cpp
+ * @ingroup Tests
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class ImplicitPolynomial3OctreeDigitizer.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <set>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/math/MPolynomial.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/shapes/implicit/ImplicitPolynomial3Shape.h"
+#include "DGtal/shapes/implicit/ImplicitPolynomial3OctreeDigitizer.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImplicitPolynomial3OctreeDigitizer.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef ImplicitPolynomial3Shape<Z3i::Space> ImplicitShape;
+typedef GaussDigitizer<Z3i::Space,ImplicitShape> DigitalShape;
+typedef ImplicitPolynomial3OctreeDigitizer<Z3i::Space> OctreeDigitizer;
+typedef ImplicitShape::Polynomial3 Polynomial3;
+
+/**
+ * Inner boundary of a digitized shape by visiting the whole domain,
+ * points outside the domain being outside the shape.
+ */
+void
+bruteForceBoundary( const DigitalShape & dig, Z3i::DigitalSet & aSet )
+{
+  const Z3i::Domain domain = dig.getDomain();
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    {
+      if ( ! dig( *it ) ) continue;
+      bool boundary = false;
+      for ( Dimension k = 0; k < 3 && ! boundary; ++k )
+        {
+          Z3i::Point q = *it;
+          q[ k ] -= 1;
+          boundary = ! domain.isInside( q ) || ! dig( q );
+          q[ k ] += 2;
+          boundary = boundary || ! domain.isInside( q ) || ! dig( q );
+        }
+      if ( boundary ) aSet.insertNew( *it );
+    }
+}
+
+/**
+ * Compares the boundary given by the octree digitizer with the one
+ * computed on the whole domain.
+ */
+bool
+checkBoundary( const Polynomial3 & P,
+               const Z3i::RealPoint & xLow, const Z3i::RealPoint & xUp,
+               double h, bool checkSurfels )
+{
+  ImplicitShape shape( P );
+  DigitalShape dig;
+  dig.attach( shape );
+  dig.init( xLow, xUp, h );
+
+  OctreeDigitizer octree;
+  octree.attach( P );
+  octree.init( xLow, xUp, h );
+  bool ok = octree.getDomain().lowerBound() == dig.getDomain().lowerBound()
+    && octree.getDomain().upperBound() == dig.getDomain().upperBound();
+
+  Z3i::DigitalSet ref( dig.getDomain() );
+  bruteForceBoundary( dig, ref );
+  Z3i::DigitalSet boundary( octree.getDomain() );
+  octree.computeBoundary( boundary );
+  trace.info() << octree << std::endl;
+  trace.info() << "boundary: " << boundary.size() << " points (expected "
+               << ref.size() << "), " << octree.nbEvaluations()
+               << " evaluations for " << octree.getDomain().size()
+               << " points" << std::endl;
+  ok = ok && boundary.size() == ref.size();
+  for ( Z3i::DigitalSet::ConstIterator it = ref.begin(); it != ref.end(); ++it )
+    ok = ok && boundary( *it );
+
+  if ( checkSurfels )
+    {
+      typedef Z3i::KSpace::SCell SCell;
+      Z3i::KSpace K;
+      K.init( octree.getLowerBound(), octree.getUpperBound(), true );
+      std::set<SCell> refSurfels;
+      Surfaces<Z3i::KSpace>::sMakeBoundary( refSurfels, K, dig,
+                                            octree.getLowerBound(),
+                                            octree.getUpperBound() );
+      std::vector<SCell> surfels;
+      octree.computeBoundarySurfels( K, std::back_inserter( surfels ) );
+      const std::set<SCell> surfelSet( surfels.begin(), surfels.end() );
+      trace.info() << "surfels: " << surfels.size() << " (expected "
+                   << refSurfels.size() << ")" << std::endl;
+      ok = ok && surfels.size() == surfelSet.size() && surfelSet == refSurfels;
+    }
+  return ok;
+}
+
+bool testOctreeDigitizer()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing ImplicitPolynomial3OctreeDigitizer ..." );
+
+  const Polynomial3 x = mmonomial<double>( 1, 0, 0 );
+  const Polynomial3 y = mmonomial<double>( 0, 1, 0 );
+  const Polynomial3 z = mmonomial<double>( 0, 0, 1 );
+
+  // off-centered sphere strictly inside the domain
+  const Polynomial3 sphere = ( x - 0.1 ) * ( x - 0.1 ) + ( y + 0.05 ) * ( y + 0.05 )
+    + z * z - 1.0;
+  nbok += checkBoundary( sphere, Z3i::RealPoint( -1.5, -1.5, -1.5 ),
+                         Z3i::RealPoint( 1.5, 1.5, 1.5 ), 0.05, true ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") sphere" << std::endl;
+
+  // same sphere, cut by the domain
+  nbok += checkBoundary( sphere, Z3i::RealPoint( -0.5, -1.5, -0.3 ),
+                         Z3i::RealPoint( 1.5, 0.6, 1.5 ), 0.05, false ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") clipped sphere" << std::endl;
+
+  // torus of radii 1 and 0.3, of degree 4
+  const Polynomial3 s = x * x + y * y + z * z + 1.0 - 0.09;
+  const Polynomial3 torus = s * s - 4.0 * ( x * x + y * y );
+  nbok += checkBoundary( torus, Z3i::RealPoint( -1.5, -1.5, -0.5 ),
+                         Z3i::RealPoint( 1.5, 1.5, 0.5 ), 0.04, true ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") torus" << std::endl;
+
+  // at a finer resolution, only points close to the surface are evaluated
+  OctreeDigitizer octree;
+  octree.attach( sphere );
+  octree.init( Z3i::RealPoint( -3.0, -3.0, -3.0 ), Z3i::RealPoint( 3.0, 3.0, 3.0 ), 0.01 );
+  std::vector<Z3i::KSpace::SCell> surfels;
+  Z3i::KSpace K;
+  K.init( octree.getLowerBound(), octree.getUpperBound(), true );
+  octree.computeBoundarySurfels( K, std::back_inserter( surfels ) );
+  trace.info() << octree << " " << surfels.size() << " surfels" << std::endl;
+  nbok += ( 10 * octree.nbEvaluations() < octree.getDomain().size()
+            && octree.nbEvaluations() < 40 * surfels.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") evaluations" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ImplicitPolynomial3OctreeDigitizer" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testOctreeDigitizer(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,192 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFrozenDigitalSurface.cpp
+ * @ingroup Tests
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class FrozenDigitalSurface.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <set>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/topology/FrozenDigitalSurface.h"
+#include "DGtal/graph/BreadthFirstVisitor.h"
+#include "DGtal/graph/CUndirectedSimpleGraph.h"
+#include "DGtal/shapes/Shapes.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class FrozenDigitalSurface.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef DigitalSetBoundary<KSpace,DigitalSet> Container;
+typedef DigitalSurface<Container> Surface;
+typedef FrozenDigitalSurface<Container> Frozen;
+BOOST_CONCEPT_ASSERT(( concepts::CUndirectedSimpleGraph< Frozen > ));
+
+/**
+ * Compares the frozen surface of a ball with a hole and a small
+ * ball with the tracked digital surface: vertices, arcs, faces and
+ * breadth-first traversal.
+ */
+bool testFrozenDigitalSurface()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing FrozenDigitalSurface..." );
+  Point p1( -10, -10, -10 );
+  Point p2( 10, 10, 10 );
+  Domain domain( p1, p2 );
+  DigitalSet set( domain );
+  Shapes<Domain>::addNorm2Ball( set, Point( -2, 0, 0 ), 6 );
+  Shapes<Domain>::removeNorm2Ball( set, Point( -2, 0, 0 ), 2 );
+  Shapes<Domain>::addNorm1Ball( set, Point( 7, 5, 5 ), 2 );
+  KSpace K;
+  K.init( p1, p2, true );
+  Surface surface( new Container( K, set ) );
+  Frozen frozen( surface );
+  trace.info() << frozen << std::endl;
+  nb++;
+  if ( frozen.isValid() && frozen.size() == surface.size()
+       && std::equal( frozen.surfels().begin(), frozen.surfels().end(),
+                      std::set<SCell>( surface.begin(), surface.end() ).begin() ) )
+    nbok++;
+  trace.info() << "(" << nbok << "/" << nb << ") vertices" << std::endl;
+
+  // Arcs.
+  bool arcsOk = true;
+  for ( Frozen::Vertex v = 0; arcsOk && v < frozen.size(); ++v )
+    {
+      std::vector<SCell> expected;
+      std::back_insert_iterator< std::vector<SCell> > out = std::back_inserter( expected );
+      surface.writeNeighbors( out, frozen.surfel( v ) );
+      std::vector<Frozen::Vertex> neighbors;
+      std::back_insert_iterator< std::vector<Frozen::Vertex> > outv = std::back_inserter( neighbors );
+      frozen.writeNeighbors( outv, v );
+      arcsOk = frozen.degree( v ) == surface.degree( frozen.surfel( v ) )
+        && neighbors.size() == expected.size()
+        && std::equal( neighbors.begin(), neighbors.end(), frozen.neighbors( v ).first );
+      for ( unsigned int i = 0; arcsOk && i < expected.size(); ++i )
+        arcsOk = frozen.surfel( neighbors[ i ] ) == expected[ i ];
+      for ( Frozen::Index a = frozen.firstArc( v ); arcsOk && a != frozen.lastArc( v ); ++a )
+        arcsOk = frozen.tail( a ) == v
+          && surface.head( frozen.arc( a ) ) == frozen.surfel( frozen.head( a ) )
+          && frozen.opposite( frozen.opposite( a ) ) == a
+          && frozen.head( frozen.opposite( a ) ) == v
+          && frozen.arc( frozen.opposite( a ) ) == surface.opposite( frozen.arc( a ) );
+    }
+  nb++;
+  if ( arcsOk && frozen.bestCapacity() <= surface.bestCapacity() ) nbok++;
+  trace.info() << "(" << nbok << "/" << nb << ") arcs" << std::endl;
+
+  // Faces.
+  Surface::FaceSet faces = surface.allFaces();
+  bool facesOk = frozen.nbFaces() == faces.size()
+    && std::equal( faces.begin(), faces.end(), &frozen.face( 0 ) );
+  for ( Frozen::Index f = 0; facesOk && f < frozen.nbFaces(); ++f )
+    {
+      Surface::VertexRange vertices = surface.verticesAroundFace( frozen.face( f ) );
+      Frozen::IndexRange range = frozen.verticesAroundFace( f );
+      facesOk = frozen.isClosed( f )
+        && vertices.size() == std::size_t( range.second - range.first );
+      for ( unsigned int i = 0; facesOk && i < vertices.size(); ++i )
+        facesOk = frozen.surfel( range.first[ i ] ) == vertices[ i ];
+    }
+  for ( Frozen::Vertex v = 0; facesOk && v < frozen.size(); ++v )
+    {
+      Frozen::IndexRange range = frozen.facesAroundVertex( v );
+      facesOk = range.second - range.first == 4;
+      for ( ; facesOk && range.first != range.second; ++range.first )
+        {
+          Frozen::IndexRange fv = frozen.verticesAroundFace( *range.first );
+          facesOk = std::find( fv.first, fv.second, v ) != fv.second;
+        }
+    }
+  nb++;
+  if ( facesOk ) nbok++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << frozen.nbFaces() << " faces" << std::endl;
+
+  // Breadth-first traversal.
+  Frozen::IndexedMap<unsigned int>::Type distances( frozen.size(), 0 );
+  BreadthFirstVisitor<Surface> visitor( surface, frozen.surfel( 0 ) );
+  Frozen::Index nbVisited = 0;
+  while ( ! visitor.finished() )
+    {
+      distances[ frozen.index( visitor.current().first ) ] = visitor.current().second;
+      ++nbVisited;
+      visitor.expand();
+    }
+  BreadthFirstVisitor<Frozen> frozenVisitor( frozen, 0 );
+  bool bfsOk = true;
+  Frozen::Index nbFrozenVisited = 0;
+  while ( bfsOk && ! frozenVisitor.finished() )
+    {
+      bfsOk = distances[ frozenVisitor.current().first ] == frozenVisitor.current().second;
+      ++nbFrozenVisited;
+      frozenVisitor.expand();
+    }
+  nb++;
+  if ( bfsOk && nbVisited == nbFrozenVisited && nbVisited < frozen.size() ) nbok++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << nbVisited << " visited" << std::endl;
+
+  // Empty surface.
+  DigitalSet empty( domain );
+  Surface emptySurface( new Container( K, empty ) );
+  Frozen frozenEmpty( emptySurface );
+  nb++;
+  if ( frozenEmpty.isValid() && frozenEmpty.size() == 0 && frozenEmpty.nbFaces() == 0 )
+    nbok++;
+  trace.info() << "(" << nbok << "/" << nb << ") empty surface" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class FrozenDigitalSurface" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testFrozenDigitalSurface();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
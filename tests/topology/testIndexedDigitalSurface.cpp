@@ -0,0 +1,223 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testIndexedDigitalSurface.cpp
+ * @ingroup Tests
+ * @author DGtal developers
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class IndexedDigitalSurface.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/topology/IndexedDigitalSurface.h"
+#include "DGtal/topology/CanonicCellEmbedder.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/shapes/Mesh.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class IndexedDigitalSurface.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef DigitalSetBoundary<KSpace,DigitalSet> Container;
+typedef DigitalSurface<Container> Surface;
+typedef IndexedDigitalSurface<Container> HalfEdgeSurface;
+
+/**
+ * Builds the half-edge surface of a ball with a cavity and of a small
+ * ball, checks its consistency with the digital surface and its
+ * Euler characteristic.
+ */
+bool testIndexedDigitalSurface()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing IndexedDigitalSurface..." );
+  Point p1( -10, -10, -10 );
+  Point p2( 10, 10, 10 );
+  Domain domain( p1, p2 );
+  DigitalSet set( domain );
+  Shapes<Domain>::addNorm2Ball( set, Point( -2, 0, 0 ), 6 );
+  Shapes<Domain>::removeNorm2Ball( set, Point( -2, 0, 0 ), 2 );
+  Shapes<Domain>::addNorm1Ball( set, Point( 7, 5, 5 ), 2 );
+  KSpace K;
+  K.init( p1, p2, true );
+  Surface surface( new Container( K, set ) );
+  HalfEdgeSurface hes;
+  nb++;
+  if ( hes.init( surface ) && hes.isValid() ) nbok++;
+  trace.info() << hes << std::endl;
+  trace.info() << "(" << nbok << "/" << nb << ") init" << std::endl;
+
+  // Three spheres.
+  long euler = (long) hes.nbVertices() - (long) hes.nbEdges() + (long) hes.nbFaces();
+  nb++;
+  if ( hes.nbVertices() == surface.size() && hes.nbArcs() == 4 * hes.nbVertices()
+       && hes.nbFaces() == surface.allClosedFaces().size() && euler == 6 )
+    nbok++;
+  trace.info() << "(" << nbok << "/" << nb << ") euler=" << euler << std::endl;
+
+  // Turning around faces and vertices.
+  bool turnOk = true;
+  for ( HalfEdgeSurface::Face f = 0; turnOk && f < hes.nbFaces(); ++f )
+    {
+      HalfEdgeSurface::ArcRange arcs = hes.arcsAroundFace( f );
+      for ( unsigned int i = 0; turnOk && i < arcs.size(); ++i )
+        turnOk = hes.faceOfArc( arcs[ i ] ) == f
+          && hes.previous( hes.next( arcs[ i ] ) ) == arcs[ i ];
+    }
+  for ( HalfEdgeSurface::Vertex v = 0; turnOk && v < hes.nbVertices(); ++v )
+    {
+      HalfEdgeSurface::ArcRange arcs = hes.outArcs( v );
+      HalfEdgeSurface::FaceRange faces = hes.facesAroundVertex( v );
+      turnOk = hes.degree( v ) == surface.degree( hes.surfel( v ) )
+        && arcs.size() == hes.degree( v ) && faces.size() == arcs.size();
+      for ( unsigned int i = 0; turnOk && i < arcs.size(); ++i )
+        turnOk = hes.tail( arcs[ i ] ) == v;
+    }
+  nb++;
+  if ( turnOk ) nbok++;
+  trace.info() << "(" << nbok << "/" << nb << ") turning around" << std::endl;
+
+  // Same OFF output as the digital surface.
+  std::ostringstream off1, off2;
+  surface.exportSurfaceAs3DOFF( off1 );
+  hes.exportSurfaceAs3DOFF( off2 );
+  nb++;
+  if ( off1.str() == off2.str() ) nbok++;
+  std::ostringstream off3, off4;
+  CanonicCellEmbedder<KSpace> embedder( K );
+  surface.exportEmbeddedSurfaceAs3DOFF( off3, embedder );
+  hes.exportEmbeddedSurfaceAs3DOFF( off4, embedder );
+  nb++;
+  if ( off3.str() == off4.str() ) nbok++;
+  trace.info() << "(" << nbok << "/" << nb << ") OFF export" << std::endl;
+
+  Mesh<RealPoint> mesh;
+  hes.addToMesh( mesh, embedder );
+  nb++;
+  if ( mesh.nbVertex() == hes.nbVertices() && mesh.nbFaces() == hes.nbFaces() )
+    nbok++;
+  trace.info() << "(" << nbok << "/" << nb << ") mesh" << std::endl;
+
+  // An open surface.
+  DigitalSet openSet( domain );
+  Shapes<Domain>::addNorm2Ball( openSet, Point( 0, 0, 10 ), 5 );
+  Surface openSurface( new Container( K, openSet ) );
+  nb++;
+  if ( ! hes.init( openSurface ) && hes.nbVertices() == 0 ) nbok++;
+  trace.info() << "(" << nbok << "/" << nb << ") open surface" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Builds the half-edge surface of the same digital surface many times
+ * with several threads (if OpenMP is enabled), and compares it with
+ * the one built by a single thread.
+ */
+bool testThreadedIndexedDigitalSurface()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing IndexedDigitalSurface with several threads..." );
+  Point p1( -12, -12, -12 );
+  Point p2( 12, 12, 12 );
+  Domain domain( p1, p2 );
+  DigitalSet set( domain );
+  Shapes<Domain>::addNorm2Ball( set, Point( 0, 0, 0 ), 10 );
+  Shapes<Domain>::removeNorm2Ball( set, Point( 0, 0, 0 ), 4 );
+  KSpace K;
+  K.init( p1, p2, true );
+  Surface surface( new Container( K, set ) );
+#ifdef WITH_OPENMP
+  const int nbThreads = omp_get_max_threads();
+  omp_set_num_threads( 1 );
+#endif
+  HalfEdgeSurface ref;
+  ref.init( surface );
+  std::ostringstream refOff;
+  ref.exportSurfaceAs3DOFF( refOff );
+#ifdef WITH_OPENMP
+  omp_set_num_threads( std::max( nbThreads, 4 ) );
+#endif
+  const unsigned int nbRuns = 20;
+  unsigned int nbSame = 0;
+  for ( unsigned int i = 0; i < nbRuns; ++i )
+    {
+      HalfEdgeSurface hes;
+      std::ostringstream off;
+      if ( hes.init( surface ) && hes.isValid() )
+        {
+          hes.exportSurfaceAs3DOFF( off );
+          if ( hes.nbArcs() == ref.nbArcs() && hes.nbFaces() == ref.nbFaces()
+               && off.str() == refOff.str() )
+            ++nbSame;
+        }
+    }
+#ifdef WITH_OPENMP
+  omp_set_num_threads( nbThreads );
+#endif
+  nb++;
+  if ( nbSame == nbRuns && surface.size() == ref.nbVertices() ) nbok++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << nbSame << "/" << nbRuns
+               << " runs identical to the sequential one" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class IndexedDigitalSurface" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testIndexedDigitalSurface()
+    && testThreadedIndexedDigitalSurface();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -38,6 +38,8 @@
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
 #include "DGtal/kernel/sets/DigitalSetConverter.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/kernel/sets/DigitalSetByBitVector.h"
 #include "DGtal/topology/MetricAdjacency.h"
 #include "DGtal/topology/DomainMetricAdjacency.h"
 #include "DGtal/topology/DomainAdjacency.h"
@@ -812,6 +814,106 @@ bool testSetTable()
   return nbok == nb;
 
 }
+/**
+ * Compares the border, the connectedness and the number of
+ * components of an object whose points are stored in a
+ * DigitalSetByBitVector with the ones of the same object stored in a
+ * DigitalSetBySTLSet.
+ */
+template <typename DT, typename Domain, typename PointPredicate>
+bool checkBitVectorObject( const DT & dt, const Domain & domain,
+                           const PointPredicate & inSet, const std::string & name )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  typedef DigitalSetByBitVector<Domain> BitSet;
+  typedef DigitalSetBySTLSet<Domain> RefSet;
+  typedef Object<DT, BitSet> BitObject;
+  typedef Object<DT, RefSet> RefObject;
+  BitSet bitSet( domain );
+  RefSet refSet( domain );
+  for ( typename Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( inSet( *it ) )
+      {
+        bitSet.insertNew( *it );
+        refSet.insertNew( *it );
+      }
+  BitObject bitObject( dt, bitSet );
+  RefObject refObject( dt, refSet );
+  trace.beginBlock ( "Object on DigitalSetByBitVector: " + name );
+  INBLOCK_TEST( bitObject.size() == refObject.size() );
+  BitObject bitBorder = bitObject.border();
+  RefObject refBorder = refObject.border();
+  bool same = bitBorder.size() == refBorder.size();
+  for ( typename RefObject::ConstIterator it = refBorder.begin();
+        same && it != refBorder.end(); ++it )
+    same = bitBorder.pointSet()( *it );
+  trace.info() << "border: " << bitBorder.size() << " points" << std::endl;
+  INBLOCK_TEST2( same, "same border" );
+  std::vector<RefObject> components;
+  std::back_insert_iterator< std::vector<RefObject> > inserter( components );
+  const unsigned int nbc = refObject.writeComponents( inserter );
+  trace.info() << "components: " << nbc << std::endl;
+  INBLOCK_TEST( bitSet.computeNbComponents( dt.kappa() ) == nbc );
+  INBLOCK_TEST( bitObject.computeConnectedness() == refObject.computeConnectedness() );
+  INBLOCK_TEST( bitObject.computeConnectedness() == ( nbc <= 1 ? CONNECTED : DISCONNECTED ) );
+  trace.endBlock();
+  return nbok == nb;
+}
+
+struct ScatteredPoints
+{
+  template <typename Point>
+  bool operator()( const Point & p ) const
+  {
+    DGtal::int64_t h = 0;
+    for ( Dimension k = 0; k < Point::dimension; ++k )
+      h = h * 1000003 + p[ k ] * 7919 + 13;
+    return ( ( h ^ ( h >> 7 ) ) & 7 ) < 4;
+  }
+};
+
+struct TwoBalls
+{
+  template <typename Point>
+  bool operator()( const Point & p ) const
+  {
+    Point c1 = Point::zero, c2 = Point::zero;
+    c1[ 0 ] = -30; c2[ 0 ] = 40;
+    return ( p - c1 ).norm() <= 4.5 || ( p - c2 ).norm() <= 5.5;
+  }
+};
+
+struct Bar
+{
+  template <typename Point>
+  bool operator()( const Point & p ) const
+  {
+    for ( Dimension k = 1; k < Point::dimension; ++k )
+      if ( p[ k ] < 0 || p[ k ] > 1 ) return false;
+    return true;
+  }
+};
+
+bool testObjectBitVector()
+{
+  typedef Z2i::Domain Domain2;
+  typedef Z3i::Domain Domain3;
+  Domain2 domain2( Z2i::Point( -70, -5 ), Z2i::Point( 130, 20 ) );
+  Domain3 domain3( Z3i::Point( -70, -5, -6 ), Z3i::Point( 70, 6, 5 ) );
+  bool ok = true;
+  ok = ok && checkBitVectorObject( Z2i::dt4_8, domain2, ScatteredPoints(), "2D 4-8, scattered" );
+  ok = ok && checkBitVectorObject( Z2i::dt8_4, domain2, ScatteredPoints(), "2D 8-4, scattered" );
+  ok = ok && checkBitVectorObject( Z2i::dt4_8, domain2, TwoBalls(), "2D 4-8, two balls" );
+  ok = ok && checkBitVectorObject( Z2i::dt8_4, domain2, Bar(), "2D 8-4, bar" );
+  ok = ok && checkBitVectorObject( Z3i::dt6_18, domain3, ScatteredPoints(), "3D 6-18, scattered" );
+  ok = ok && checkBitVectorObject( Z3i::dt18_6, domain3, ScatteredPoints(), "3D 18-6, scattered" );
+  ok = ok && checkBitVectorObject( Z3i::dt26_6, domain3, ScatteredPoints(), "3D 26-6, scattered" );
+  ok = ok && checkBitVectorObject( Z3i::dt6_26, domain3, TwoBalls(), "3D 6-26, two balls" );
+  ok = ok && checkBitVectorObject( Z3i::dt26_6, domain3, Bar(), "3D 26-6, bar" );
+  return ok;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -828,7 +930,8 @@ int main( int argc, char** argv )
     && testSimplePoints3D()
     && testSimplePoints2D()
     && testObjectGraph()
-    && testSetTable();
+    && testSetTable()
+    && testObjectBitVector();
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
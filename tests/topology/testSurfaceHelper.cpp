@@ -30,6 +30,10 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
 #include <fstream>
+#include <set>
+#include <vector>
+#include <iterator>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "ConfigTest.h"
 #include "DGtal/helpers/StdDefs.h"
@@ -315,6 +319,70 @@ bool testFindABel()
 }
 
 
+/**
+* Checks that the parallel boundary extraction by slabs gives the
+* same surfels as Surfaces::sMakeBoundary and Surfaces::uMakeBoundary,
+* and that they are written in increasing order.
+*/
+template <typename KSpace3D>
+bool testParallelMakeBoundary()
+{
+  typedef KSpace3D                   KSpace;
+  typedef typename KSpace::Space     Space;
+  typedef typename KSpace::Point     Point;
+  typedef typename KSpace::Cell      Cell;
+  typedef typename KSpace::SCell     SCell;
+  typedef HyperRectDomain<Space>     Domain;
+  typedef DigitalSetBySTLSet<Domain> DigitalSet;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing Surfaces::sParallelMakeBoundary." );
+  Point p1( -12, -10, -8 );
+  Point p2(  12,  10, 300 );
+  KSpace K; K.init( p1, p2, true );
+  Domain domain( p1, p2 );
+  DigitalSet aSet( domain );
+  Shapes<Domain>::addNorm2Ball( aSet, Point::zero, 7 );
+  Shapes<Domain>::addNorm1Ball( aSet, Point( 3, 0, 150 ), 9 );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( 0, 0, 300 ), 5 );
+  aSet.insert( Point( 12, 10, -8 ) );
+
+  std::set<SCell> sBoundary, sParallelBoundary;
+  Surfaces<KSpace>::sMakeBoundary( sBoundary, K, aSet, p1, p2 );
+  Surfaces<KSpace>::sParallelMakeBoundary( sParallelBoundary, K, aSet, p1, p2 );
+  std::vector<SCell> sSurfels;
+  std::back_insert_iterator< std::vector<SCell> > sOut = std::back_inserter( sSurfels );
+  Surfaces<KSpace>::sParallelWriteBoundary( sOut, K, aSet, p1, p2 );
+  trace.info() << sBoundary.size() << " signed surfels." << std::endl;
+  ++nb, nbok += ( ! sBoundary.empty() && sBoundary == sParallelBoundary ) ? 1 : 0;
+  ++nb, nbok += ( sSurfels.size() == sBoundary.size()
+                  && std::equal( sSurfels.begin(), sSurfels.end(), sBoundary.begin() ) ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") signed surfels" << std::endl;
+
+  std::set<Cell> uBoundary, uParallelBoundary;
+  Surfaces<KSpace>::uMakeBoundary( uBoundary, K, aSet, p1, p2 );
+  Surfaces<KSpace>::uParallelMakeBoundary( uParallelBoundary, K, aSet, p1, p2 );
+  std::vector<Cell> uSurfels;
+  std::back_insert_iterator< std::vector<Cell> > uOut = std::back_inserter( uSurfels );
+  Surfaces<KSpace>::uParallelWriteBoundary( uOut, K, aSet, p1, p2 );
+  ++nb, nbok += ( uBoundary.size() == sBoundary.size() && uBoundary == uParallelBoundary ) ? 1 : 0;
+  ++nb, nbok += ( uSurfels.size() == uBoundary.size()
+                  && std::equal( uSurfels.begin(), uSurfels.end(), uBoundary.begin() ) ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") unsigned surfels" << std::endl;
+
+  // Sub-domain thinner than the number of slabs.
+  Point q1( -12, -10, 2 );
+  Point q2(  12,  10, 5 );
+  sBoundary.clear(); sParallelBoundary.clear();
+  Surfaces<KSpace>::sMakeBoundary( sBoundary, K, aSet, q1, q2 );
+  Surfaces<KSpace>::sParallelMakeBoundary( sParallelBoundary, K, aSet, q1, q2 );
+  ++nb, nbok += ( ! sBoundary.empty() && sBoundary == sParallelBoundary ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") sub-domain" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -327,7 +395,8 @@ int main( int argc, char** argv )
   trace.info() << endl;
 
   bool res = testComputeInterior()
-    && testFindABel< KhalimskySpaceND<3,int> >()  && test3dSurfaceHelper();
+    && testFindABel< KhalimskySpaceND<3,int> >()  && test3dSurfaceHelper()
+    && testParallelMakeBoundary< KhalimskySpaceND<3,int> >();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;